@@ -0,0 +1,495 @@
+#ifndef AGGREGATINGLIST_HPP
+#define AGGREGATINGLIST_HPP
+
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <bit>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+#include "SinglyLinkedList.hpp"
+
+/**
+ * @brief Monoid adding elements, with 0 as identity.
+ * @tparam T Type of elements.
+ */
+template<typename T>
+struct SumMonoid {
+    T identity() const { return T(); }
+    T operator()(const T& a, const T& b) const { return a + b; }
+};
+
+/**
+ * @brief Monoid keeping the smallest element, with the largest value of T as identity.
+ * @tparam T Type of elements.
+ */
+template<typename T>
+struct MinMonoid {
+    T identity() const {
+        if constexpr (std::numeric_limits<T>::has_infinity) return std::numeric_limits<T>::infinity();
+        return std::numeric_limits<T>::max();
+    }
+    T operator()(const T& a, const T& b) const { return b < a ? b : a; }
+};
+
+/**
+ * @brief Monoid keeping the largest element, with the lowest value of T as identity.
+ * @tparam T Type of elements.
+ */
+template<typename T>
+struct MaxMonoid {
+    T identity() const {
+        if constexpr (std::numeric_limits<T>::has_infinity) return -std::numeric_limits<T>::infinity();
+        return std::numeric_limits<T>::lowest();
+    }
+    T operator()(const T& a, const T& b) const { return a < b ? b : a; }
+};
+
+/**
+ * @brief A FIFO list that maintains the aggregate of its elements under a monoid.
+ *
+ * The elements live in a SinglyLinkedList. Aggregates are kept with the two-stack technique:
+ * the front part of the list has a stack of suffix aggregates, popped by pop_front(), and the
+ * back part has a single running aggregate, extended by push_back(). When the front part runs
+ * out, the suffix aggregates of the whole list are rebuilt in one pass. Every element is thus
+ * combined a bounded number of times, so push_back(), pop_front() and aggregate() are amortized
+ * O(1) and a sliding-window query never traverses the list. The monoid's combine operation must
+ * be associative; it need not be commutative.
+ *
+ * @tparam T Type of elements stored in the list.
+ * @tparam Monoid Function object with identity() and an associative operator()(a, b).
+ */
+template<typename T, typename Monoid = SumMonoid<T>>
+class AggregatingList {
+private:
+    SinglyLinkedList<T> items; //!< The elements, front to back.
+    std::vector<T> front_aggregates; //!< Aggregates of the last 1, 2, ... elements of the front part.
+    T back_aggregate; //!< Aggregate of the elements after the front part.
+    [[no_unique_address]] Monoid monoid; //!< The combine operation and its identity.
+
+    /**
+     * @brief Makes every element part of the front and rebuilds the suffix aggregates.
+     */
+    void flip() {
+        std::vector<const T*> elements;
+        elements.reserve(items.size());
+        for (const T& value : items) elements.push_back(&value);
+        T suffix = monoid.identity();
+        for (std::size_t i = elements.size(); i-- > 0;) {
+            suffix = monoid(*elements[i], suffix);
+            front_aggregates.push_back(suffix);
+        }
+        back_aggregate = monoid.identity();
+    }
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using ConstIterator = typename SinglyLinkedList<T>::ConstIterator;
+
+    /**
+     * @brief Constructs an empty AggregatingList.
+     * @param op The monoid to aggregate with.
+     */
+    explicit AggregatingList(Monoid op = Monoid()) : back_aggregate(op.identity()), monoid(std::move(op)) {}
+
+    /**
+     * @brief Checks if the list is empty.
+     * @return True if the list is empty, false otherwise.
+     */
+    bool empty() const { return items.empty(); }
+
+    /**
+     * @brief Gets the size of the list.
+     * @return The number of elements in the list.
+     */
+    std::size_t size() const { return items.size(); }
+
+    /**
+     * @brief Adds an element to the end of the list.
+     * @param value The value to add.
+     */
+    void push_back(const T& value) {
+        T extended = monoid(back_aggregate, value);
+        items.push_back(value);
+        back_aggregate = std::move(extended);
+    }
+
+    /**
+     * @brief Adds an element to the end of the list.
+     * @param value The value to add.
+     */
+    void push(const T& value) {
+        push_back(value);
+    }
+
+    /**
+     * @brief Removes the element at the front of the list.
+     * @throws std::runtime_error if the list is empty.
+     */
+    void pop_front() {
+        if (items.empty()) {
+            throw std::runtime_error("List is empty: cannot pop front.");
+        }
+        if (front_aggregates.empty()) flip();
+        items.pop_front();
+        front_aggregates.pop_back();
+    }
+
+    /**
+     * @brief Removes the element at the front of the list.
+     * @throws std::runtime_error if the list is empty.
+     */
+    void pop() {
+        pop_front();
+    }
+
+    /**
+     * @brief Retrieves the element at the front of the list.
+     * @return A reference to the element.
+     * @throws std::runtime_error if the list is empty.
+     */
+    const T& front() const { return items.front(); }
+
+    /**
+     * @brief Retrieves the element at the back of the list.
+     * @return A reference to the element.
+     * @throws std::runtime_error if the list is empty.
+     */
+    const T& back() const { return items.back(); }
+
+    /**
+     * @brief Gets the aggregate of every element, front to back, in amortized O(1).
+     * @return The aggregate; the monoid's identity if the list is empty.
+     */
+    T aggregate() const {
+        if (front_aggregates.empty()) return back_aggregate;
+        return monoid(front_aggregates.back(), back_aggregate);
+    }
+
+    /**
+     * @brief Removes every element.
+     */
+    void clear() {
+        items.clear();
+        front_aggregates.clear();
+        back_aggregate = monoid.identity();
+    }
+
+    /**
+     * @brief Gets a const iterator to the first element.
+     * @return A ConstIterator to the first element.
+     */
+    ConstIterator begin() const { return items.begin(); }
+
+    /**
+     * @brief Gets a const iterator to the end of the list.
+     * @return A ConstIterator to the end.
+     */
+    ConstIterator end() const { return items.end(); }
+};
+
+/**
+ * @brief A list with positional edits and range aggregates under a monoid, in O(log n) expected.
+ *
+ * The elements are the bottom lane of an indexable skip list. Every link of every lane stores
+ * how many elements it skips and the aggregate of those elements, from just after its source up
+ * to and including its target; a link to the end covers the rest of the list. An edit changes
+ * only the links whose span contains the edited position, one per lane, and each of them is
+ * recomputed from the expected two links below it. A range aggregate climbs to the longest links
+ * that fit inside the range, so it combines O(log n) stored aggregates instead of every element.
+ * The monoid's combine operation must be associative; it need not be commutative.
+ *
+ * @tparam T Type of elements stored in the list.
+ * @tparam Monoid Function object with identity() and an associative operator()(a, b).
+ */
+template<typename T, typename Monoid = SumMonoid<T>>
+class RangeAggregatingList {
+private:
+    static constexpr std::size_t max_levels = 32; //!< Number of lanes of the head.
+
+    struct Node;
+
+    /**
+     * @brief A link of one lane.
+     */
+    struct Link {
+        Node* next = nullptr; //!< The target, or null for the end of the list.
+        std::size_t width = 0; //!< Number of elements after the source, up to and including the target.
+        T aggregate; //!< Aggregate of those elements.
+    };
+
+    /**
+     * @brief The links leaving a node or the head, one per lane.
+     */
+    struct Tower {
+        std::vector<Link> links; //!< The links, bottom lane first.
+    };
+
+    struct Node : Tower {
+        T value; //!< The element.
+
+        explicit Node(const T& val) : value(val) {}
+    };
+
+    Tower head; //!< Links leaving the front of the list.
+    std::size_t levels; //!< Number of lanes in use.
+    std::size_t list_size; //!< Number of elements in the list.
+    std::minstd_rand random; //!< Source of tower heights.
+    [[no_unique_address]] Monoid monoid; //!< The combine operation and its identity.
+
+    /**
+     * @brief Recomputes the width and aggregate of one link from the lane below.
+     * @param tower The link's source.
+     * @param level The link's lane.
+     */
+    void recompute(Tower* tower, std::size_t level) {
+        Link& link = tower->links[level];
+        if (level == 0) {
+            link.width = link.next ? 1 : 0;
+            link.aggregate = link.next ? link.next->value : monoid.identity();
+            return;
+        }
+        std::size_t width = 0;
+        T aggregate = monoid.identity();
+        for (Tower* x = tower; x != link.next;) {
+            const Link& below = x->links[level - 1];
+            width += below.width;
+            aggregate = monoid(aggregate, below.aggregate);
+            x = below.next;
+            if (!x) break;
+        }
+        link.width = width;
+        link.aggregate = std::move(aggregate);
+    }
+
+    /**
+     * @brief Finds, in every lane, the last tower before a position.
+     * @param index The position; the towers found hold at most index elements up to themselves.
+     * @param preds Receives the tower of every lane in use.
+     */
+    void find(std::size_t index, Tower** preds) {
+        Tower* x = &head;
+        std::size_t count = 0;
+        for (std::size_t level = levels; level-- > 0;) {
+            while (x->links[level].next && count + x->links[level].width <= index) {
+                count += x->links[level].width;
+                x = x->links[level].next;
+            }
+            preds[level] = x;
+        }
+    }
+
+    const Node* node_at(std::size_t index) const {
+        const Tower* x = &head;
+        std::size_t count = 0;
+        for (std::size_t level = levels; level-- > 0;) {
+            while (x->links[level].next && count + x->links[level].width <= index + 1) {
+                count += x->links[level].width;
+                x = x->links[level].next;
+            }
+        }
+        return static_cast<const Node*>(x);
+    }
+
+    std::size_t random_height() {
+        auto bits = static_cast<std::uint32_t>(random());
+        return 1 + static_cast<std::size_t>(std::countr_zero(bits | (1u << (max_levels - 1))));
+    }
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    /**
+     * @brief Constructs an empty RangeAggregatingList.
+     * @param op The monoid to aggregate with.
+     */
+    explicit RangeAggregatingList(Monoid op = Monoid()) : levels(1), list_size(0), monoid(std::move(op)) {
+        head.links.resize(max_levels, Link{nullptr, 0, monoid.identity()});
+    }
+
+    RangeAggregatingList(const RangeAggregatingList&) = delete;
+    RangeAggregatingList& operator=(const RangeAggregatingList&) = delete;
+
+    /**
+     * @brief Destructor for RangeAggregatingList, freeing the nodes along the bottom lane.
+     */
+    ~RangeAggregatingList() {
+        clear();
+    }
+
+    /**
+     * @brief Checks if the list is empty.
+     * @return True if the list is empty, false otherwise.
+     */
+    bool empty() const { return list_size == 0; }
+
+    /**
+     * @brief Gets the size of the list.
+     * @return The number of elements in the list.
+     */
+    std::size_t size() const { return list_size; }
+
+    /**
+     * @brief Retrieves the element at a position.
+     * @param index The position.
+     * @return A reference to the element.
+     * @throws std::out_of_range if the index is out of range.
+     */
+    const T& get(std::size_t index) const {
+        if (index >= list_size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return node_at(index)->value;
+    }
+
+    /**
+     * @brief Inserts an element before a position.
+     * @param index The position; size() appends.
+     * @param value The value to insert.
+     * @throws std::out_of_range if the index is greater than size().
+     */
+    void insert(std::size_t index, const T& value) {
+        if (index > list_size) {
+            throw std::out_of_range("Index out of range");
+        }
+        std::size_t height = random_height();
+        auto owned = std::make_unique<Node>(value);
+        owned->links.resize(height, Link{nullptr, 0, monoid.identity()});
+        Node* node = owned.release();
+        if (height > levels) levels = height;
+        Tower* preds[max_levels] = {};
+        find(index, preds);
+        for (std::size_t level = 0; level < height; ++level) {
+            node->links[level].next = preds[level]->links[level].next;
+            preds[level]->links[level].next = node;
+        }
+        for (std::size_t level = 0; level < levels; ++level) {
+            recompute(preds[level], level);
+            if (level < height) recompute(node, level);
+        }
+        ++list_size;
+    }
+
+    /**
+     * @brief Removes the element at a position.
+     * @param index The position.
+     * @throws std::out_of_range if the index is out of range.
+     */
+    void erase(std::size_t index) {
+        if (index >= list_size) {
+            throw std::out_of_range("Index out of range");
+        }
+        Tower* preds[max_levels] = {};
+        find(index, preds);
+        Node* node = preds[0]->links[0].next;
+        for (std::size_t level = 0; level < node->links.size(); ++level) {
+            preds[level]->links[level].next = node->links[level].next;
+        }
+        for (std::size_t level = 0; level < levels; ++level) recompute(preds[level], level);
+        delete node;
+        --list_size;
+        while (levels > 1 && !head.links[levels - 1].next) --levels;
+    }
+
+    /**
+     * @brief Replaces the element at a position.
+     * @param index The position.
+     * @param value The new value.
+     * @throws std::out_of_range if the index is out of range.
+     */
+    void set(std::size_t index, const T& value) {
+        if (index >= list_size) {
+            throw std::out_of_range("Index out of range");
+        }
+        Tower* preds[max_levels] = {};
+        find(index, preds);
+        preds[0]->links[0].next->value = value;
+        for (std::size_t level = 0; level < levels; ++level) recompute(preds[level], level);
+    }
+
+    /**
+     * @brief Adds an element to the end of the list.
+     * @param value The value to add.
+     */
+    void push_back(const T& value) {
+        insert(list_size, value);
+    }
+
+    /**
+     * @brief Removes the element at the front of the list.
+     * @throws std::runtime_error if the list is empty.
+     */
+    void pop_front() {
+        if (list_size == 0) {
+            throw std::runtime_error("List is empty: cannot pop front.");
+        }
+        erase(0);
+    }
+
+    /**
+     * @brief Gets the aggregate of the elements in a range of positions.
+     * @param first The position of the first element.
+     * @param last The position past the last element.
+     * @return The aggregate, front to back; the monoid's identity for an empty range.
+     * @throws std::out_of_range if the range is not inside the list.
+     */
+    T aggregate(std::size_t first, std::size_t last) const {
+        if (first > last || last > list_size) {
+            throw std::out_of_range("Index out of range");
+        }
+        T result = monoid.identity();
+        if (first == last) return result;
+        const Tower* x = first == 0 ? &head : node_at(first - 1);
+        std::size_t count = first;
+        while (count < last) {
+            std::size_t level = x->links.size();
+            while (level-- > 1 && (!x->links[level].next || count + x->links[level].width > last)) {}
+            const Link& link = x->links[level];
+            result = monoid(result, link.aggregate);
+            count += link.width;
+            x = link.next;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Gets the aggregate of every element.
+     * @return The aggregate, front to back; the monoid's identity if the list is empty.
+     */
+    T aggregate() const {
+        T result = monoid.identity();
+        for (const Tower* x = &head; x;) {
+            const Link& link = x->links[levels - 1];
+            result = monoid(result, link.aggregate);
+            x = link.next;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Removes every element.
+     */
+    void clear() {
+        Node* node = head.links[0].next;
+        while (node) {
+            Node* next = node->links[0].next;
+            delete node;
+            node = next;
+        }
+        for (Link& link : head.links) link = Link{nullptr, 0, monoid.identity()};
+        levels = 1;
+        list_size = 0;
+    }
+};
+
+#endif // AGGREGATINGLIST_HPP
@@ -0,0 +1,152 @@
+#include "AggregatingList.hpp"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <deque>
+#include <vector>
+
+// Concatenation is associative but not commutative, so it checks that aggregates keep the order.
+struct ConcatMonoid {
+    std::string identity() const { return ""; }
+    std::string operator()(const std::string& a, const std::string& b) const { return a + b; }
+};
+
+int main() {
+    std::cout << "AggregatingList MWE test starts!\n";
+
+    // Test sum, min and max of an empty and a small queue
+    AggregatingList<int> sums;
+    assert(sums.empty() && sums.aggregate() == 0);
+    sums.push_back(3);
+    sums.push_back(4);
+    sums.push(5);
+    assert(sums.size() == 3 && sums.aggregate() == 12 && sums.front() == 3 && sums.back() == 5);
+    sums.pop_front();
+    assert(sums.aggregate() == 9);
+    sums.push_back(1);
+    assert(sums.aggregate() == 10);
+    AggregatingList<double, MinMonoid<double>> mins;
+    AggregatingList<int, MaxMonoid<int>> maxes;
+    assert(mins.aggregate() > 1e300 && maxes.aggregate() == std::numeric_limits<int>::lowest());
+    std::cout << "0\n";
+
+    // Test a sliding window against recomputing every aggregate
+    std::mt19937 rng(7);
+    std::deque<int> window;
+    AggregatingList<int, MinMonoid<int>> windowMin;
+    AggregatingList<int, MaxMonoid<int>> windowMax;
+    AggregatingList<long long, SumMonoid<long long>> windowSum;
+    for (int step = 0; step < 20000; ++step) {
+        int value = static_cast<int>(rng() % 1000) - 500;
+        window.push_back(value);
+        windowMin.push_back(value);
+        windowMax.push_back(value);
+        windowSum.push_back(value);
+        if (window.size() > 37 || (step % 11 == 0 && !window.empty())) {
+            window.pop_front();
+            windowMin.pop_front();
+            windowMax.pop_front();
+            windowSum.pop_front();
+        }
+        if (window.empty()) continue;
+        assert(windowMin.aggregate() == *std::min_element(window.begin(), window.end()));
+        assert(windowMax.aggregate() == *std::max_element(window.begin(), window.end()));
+        assert(windowSum.aggregate() == std::accumulate(window.begin(), window.end(), 0LL));
+        assert(windowSum.front() == window.front() && windowSum.back() == window.back());
+    }
+    assert(std::equal(windowSum.begin(), windowSum.end(), window.begin(), window.end()));
+    std::cout << "1\n";
+
+    // Test that the aggregate keeps the element order
+    AggregatingList<std::string, ConcatMonoid> words;
+    for (std::string word : {"a", "b", "c", "d"}) words.push_back(word);
+    words.pop_front();
+    words.push_back("e");
+    assert(words.aggregate() == "bcde");
+    words.pop_front();
+    words.pop_front();
+    words.push_back("f");
+    assert(words.aggregate() == "def");
+    words.clear();
+    assert(words.empty() && words.aggregate().empty());
+    bool thrown = false;
+    try {
+        words.pop_front();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "2\n";
+
+    // Test positional edits and range aggregates against a std::vector
+    RangeAggregatingList<std::string, ConcatMonoid> ranged;
+    std::vector<std::string> mirror;
+    assert(ranged.aggregate().empty() && ranged.aggregate(0, 0).empty());
+    for (int step = 0; step < 4000; ++step) {
+        std::size_t op = rng() % 4;
+        std::string value(1, static_cast<char>('a' + rng() % 26));
+        if (op <= 1 || mirror.empty()) {
+            std::size_t at = rng() % (mirror.size() + 1);
+            ranged.insert(at, value);
+            mirror.insert(mirror.begin() + static_cast<std::ptrdiff_t>(at), value);
+        } else if (op == 2) {
+            std::size_t at = rng() % mirror.size();
+            ranged.erase(at);
+            mirror.erase(mirror.begin() + static_cast<std::ptrdiff_t>(at));
+        } else {
+            std::size_t at = rng() % mirror.size();
+            ranged.set(at, value);
+            mirror[at] = value;
+        }
+        assert(ranged.size() == mirror.size());
+        std::size_t first = rng() % (mirror.size() + 1);
+        std::size_t last = first + rng() % (mirror.size() - first + 1);
+        std::string expected;
+        for (std::size_t i = first; i < last; ++i) expected += mirror[i];
+        assert(ranged.aggregate(first, last) == expected);
+        if (step % 97 == 0) {
+            assert(ranged.aggregate() == std::accumulate(mirror.begin(), mirror.end(), std::string()));
+            for (std::size_t i = 0; i < mirror.size(); ++i) assert(ranged.get(i) == mirror[i]);
+        }
+    }
+    std::cout << "3\n";
+
+    // Test queue operations, bounds and clear on the range list
+    RangeAggregatingList<int, MaxMonoid<int>> rangedMax;
+    for (int i = 0; i < 1000; ++i) rangedMax.push_back((i * 37) % 1001);
+    assert(rangedMax.aggregate() == 1000 && rangedMax.aggregate(0, 10) == 333);
+    rangedMax.pop_front();
+    assert(rangedMax.size() == 999 && rangedMax.get(0) == 37);
+    thrown = false;
+    try {
+        rangedMax.aggregate(5, 1000);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        rangedMax.insert(1000, 0);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    rangedMax.clear();
+    assert(rangedMax.empty() && rangedMax.aggregate() == std::numeric_limits<int>::lowest());
+    rangedMax.push_back(4);
+    assert(rangedMax.aggregate(0, 1) == 4);
+    thrown = false;
+    try {
+        rangedMax.erase(1);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "4\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,320 @@
+#ifndef ASYNCQUEUE_HPP
+#define ASYNCQUEUE_HPP
+
+#include <coroutine>
+#include <optional>
+#include <stdexcept>
+#include <exception>
+#include <utility>
+#include "SinglyLinkedList.hpp"
+
+/**
+ * @brief A single-threaded executor that resumes scheduled coroutines in batches.
+ *
+ * Coroutines scheduled while a batch is running are collected into the next batch, so one call
+ * to run_once() resumes exactly the coroutines that were ready when it started.
+ */
+class SingleThreadExecutor {
+private:
+    SinglyLinkedList<std::coroutine_handle<>> ready; //!< Coroutines waiting to be resumed.
+
+public:
+    /**
+     * @brief Queues a suspended coroutine for resumption.
+     * @param handle The coroutine to resume.
+     */
+    void schedule(std::coroutine_handle<> handle) {
+        ready.push_back(handle);
+    }
+
+    /**
+     * @brief Resumes every coroutine that is ready now.
+     * @return The number of coroutines resumed.
+     */
+    std::size_t run_once() {
+        SinglyLinkedList<std::coroutine_handle<>> batch;
+        swap(batch, ready);
+        for (std::coroutine_handle<> handle : batch) {
+            handle.resume();
+        }
+        return batch.size();
+    }
+
+    /**
+     * @brief Runs batches until no coroutine is ready.
+     * @return The total number of coroutines resumed.
+     */
+    std::size_t run() {
+        std::size_t total = 0;
+        while (std::size_t n = run_once()) {
+            total += n;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Check if there are no coroutines waiting to be resumed.
+     * @return True if nothing is scheduled, false if not.
+     */
+    bool idle() const {
+        return ready.empty();
+    }
+};
+
+/**
+ * @brief A fire-and-forget coroutine started through SingleThreadExecutor::spawn().
+ *
+ * The coroutine frame destroys itself when the coroutine finishes. Exceptions escaping the
+ * coroutine terminate the program.
+ */
+class DetachedTask {
+public:
+    struct promise_type {
+        DetachedTask get_return_object() { return DetachedTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    DetachedTask(DetachedTask&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    DetachedTask(const DetachedTask&) = delete;
+    DetachedTask& operator=(const DetachedTask&) = delete;
+
+    /**
+     * @brief Destroys the coroutine if it was never spawned.
+     */
+    ~DetachedTask() {
+        if (handle) handle.destroy();
+    }
+
+    /**
+     * @brief Schedules the coroutine on an executor and gives up ownership of it.
+     * @param executor The executor that runs the coroutine.
+     */
+    void spawn(SingleThreadExecutor& executor) && {
+        executor.schedule(std::exchange(handle, nullptr));
+    }
+
+private:
+    explicit DetachedTask(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+    std::coroutine_handle<promise_type> handle; //!< The suspended coroutine, until spawned.
+};
+
+/**
+ * @brief A bounded channel between coroutines running on one SingleThreadExecutor.
+ *
+ * co_await pop() suspends until an element arrives, and co_await push() suspends while the buffer
+ * holds capacity elements. Elements go straight to a waiting consumer when there is one, and a
+ * consumer finding the buffer empty takes its element straight from a waiting producer, so a
+ * capacity of 0 makes every push() a rendezvous with a pop(). Suspended coroutines are resumed
+ * through the executor, which runs them in batches. The queue is not thread-safe: every producer
+ * and consumer must run on the executor's thread. A coroutine must not be destroyed while it is
+ * suspended on the queue.
+ *
+ * @tparam T Type of elements passed through the queue.
+ */
+template<typename T>
+class AsyncQueue {
+private:
+    struct PopAwaiter;
+    struct PushAwaiter;
+
+    SingleThreadExecutor& executor; //!< Executor that resumes waiting coroutines.
+    std::size_t capacity; //!< Maximum number of buffered elements.
+    SinglyLinkedList<T> buffer; //!< Elements pushed but not yet popped.
+    SinglyLinkedList<PopAwaiter*> pop_waiters; //!< Consumers waiting for an element.
+    SinglyLinkedList<PushAwaiter*> push_waiters; //!< Producers waiting for buffer space.
+    bool closed; //!< Whether close() has been called.
+
+    /**
+     * @brief Hands a value to the oldest waiting consumer.
+     * @param value The value to hand over.
+     * @return True if a consumer took the value, false if none is waiting.
+     */
+    bool deliver(T& value) {
+        if (pop_waiters.empty()) return false;
+        PopAwaiter* waiter = pop_waiters.front();
+        pop_waiters.pop_front();
+        waiter->slot.emplace(std::move(value));
+        executor.schedule(waiter->handle);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest buffered element and admits the oldest waiting producer.
+     * @return The removed element.
+     */
+    T take() {
+        T value = std::move(buffer.front());
+        buffer.pop_front();
+        if (!push_waiters.empty()) {
+            PushAwaiter* waiter = push_waiters.front();
+            push_waiters.pop_front();
+            buffer.push_back(std::move(waiter->value));
+            executor.schedule(waiter->handle);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Takes the next element from the buffer or, when it is empty, from the oldest waiting producer.
+     * @param slot Receives the element.
+     * @return True if an element was taken, false if none is available.
+     */
+    bool receive(std::optional<T>& slot) {
+        if (!buffer.empty()) {
+            slot.emplace(take());
+            return true;
+        }
+        // With a buffer of capacity 0, producers wait for a consumer instead of filling it.
+        if (push_waiters.empty()) return false;
+        PushAwaiter* waiter = push_waiters.front();
+        push_waiters.pop_front();
+        slot.emplace(std::move(waiter->value));
+        executor.schedule(waiter->handle);
+        return true;
+    }
+
+    /**
+     * @brief Awaitable returned by pop().
+     */
+    struct PopAwaiter {
+        AsyncQueue& queue;
+        std::optional<T> slot;
+        std::coroutine_handle<> handle;
+
+        bool await_ready() {
+            return queue.receive(slot) || queue.closed;
+        }
+
+        void await_suspend(std::coroutine_handle<> h) {
+            handle = h;
+            queue.pop_waiters.push_back(this);
+        }
+
+        std::optional<T> await_resume() {
+            return std::move(slot);
+        }
+    };
+
+    /**
+     * @brief Awaitable returned by push().
+     */
+    struct PushAwaiter {
+        AsyncQueue& queue;
+        T value;
+        std::coroutine_handle<> handle;
+        bool rejected = false;
+
+        bool await_ready() {
+            if (queue.closed) {
+                rejected = true;
+                return true;
+            }
+            if (queue.deliver(value)) return true;
+            if (queue.buffer.size() < queue.capacity) {
+                queue.buffer.push_back(std::move(value));
+                return true;
+            }
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> h) {
+            handle = h;
+            queue.push_waiters.push_back(this);
+        }
+
+        void await_resume() const {
+            if (rejected) {
+                throw std::runtime_error("Queue is closed: cannot push.");
+            }
+        }
+    };
+
+public:
+    /**
+     * @brief Constructs an AsyncQueue.
+     * @param exec The executor that resumes waiting coroutines.
+     * @param maxBuffered The maximum number of buffered elements before push() suspends; 0 for an unbuffered queue.
+     */
+    AsyncQueue(SingleThreadExecutor& exec, std::size_t maxBuffered) : executor(exec), capacity(maxBuffered), closed(false) {}
+
+    AsyncQueue(const AsyncQueue&) = delete;
+    AsyncQueue& operator=(const AsyncQueue&) = delete;
+
+    /**
+     * @brief Waits for the next element.
+     * @return An awaitable yielding the element, or std::nullopt once the queue is closed and drained.
+     */
+    PopAwaiter pop() {
+        return PopAwaiter{*this, std::nullopt, nullptr};
+    }
+
+    /**
+     * @brief Adds an element, waiting while the buffer is full.
+     * @param value The value to add.
+     * @return An awaitable that completes once the element is queued.
+     * @throws std::runtime_error from co_await if the queue is or gets closed before the element is queued.
+     */
+    PushAwaiter push(T value) {
+        return PushAwaiter{*this, std::move(value), nullptr};
+    }
+
+    /**
+     * @brief Adds an element without waiting.
+     * @param value The value to add.
+     * @return True if the element was queued, false if the buffer is full or the queue is closed.
+     */
+    bool try_push(T value) {
+        if (closed) return false;
+        if (deliver(value)) return true;
+        if (buffer.size() >= capacity) return false;
+        buffer.push_back(std::move(value));
+        return true;
+    }
+
+    /**
+     * @brief Removes the next element without waiting.
+     * @return The element, or std::nullopt if none is buffered or offered by a waiting producer.
+     */
+    std::optional<T> try_pop() {
+        std::optional<T> value;
+        receive(value);
+        return value;
+    }
+
+    /**
+     * @brief Closes the queue.
+     *
+     * Waiting consumers resume with std::nullopt and waiting producers resume with an exception.
+     * Elements already buffered can still be popped.
+     */
+    void close() {
+        closed = true;
+        while (!pop_waiters.empty()) {
+            executor.schedule(pop_waiters.front()->handle);
+            pop_waiters.pop_front();
+        }
+        while (!push_waiters.empty()) {
+            push_waiters.front()->rejected = true;
+            executor.schedule(push_waiters.front()->handle);
+            push_waiters.pop_front();
+        }
+    }
+
+    /**
+     * @brief Gets the number of buffered elements.
+     * @return The number of elements.
+     */
+    std::size_t size() const { return buffer.size(); }
+
+    /**
+     * @brief Check if the queue has been closed.
+     * @return True if close() has been called, false if not.
+     */
+    bool is_closed() const { return closed; }
+};
+
+#endif // ASYNCQUEUE_HPP
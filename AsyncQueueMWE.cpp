@@ -0,0 +1,118 @@
+#include "AsyncQueue.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+
+DetachedTask producer(AsyncQueue<int>& queue, int count, int& pushed) {
+    for (int i = 0; i < count; ++i) {
+        co_await queue.push(i);
+        ++pushed;
+    }
+    queue.close();
+}
+
+DetachedTask consumer(AsyncQueue<int>& queue, std::vector<int>& received) {
+    while (std::optional<int> value = co_await queue.pop()) {
+        received.push_back(*value);
+    }
+}
+
+DetachedTask popOnce(AsyncQueue<std::string>& queue, std::vector<std::string>& received) {
+    std::optional<std::string> value = co_await queue.pop();
+    received.push_back(value ? *value : "<closed>");
+}
+
+DetachedTask pushAfterClose(AsyncQueue<int>& queue, bool& thrown) {
+    try {
+        co_await queue.push(1);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+}
+
+int main() {
+    std::cout << "AsyncQueue MWE test starts!\n";
+
+    // Test producer and consumer exchanging elements in order
+    SingleThreadExecutor executor;
+    AsyncQueue<int> queue(executor, 4);
+    std::vector<int> received;
+    int pushed = 0;
+    consumer(queue, received).spawn(executor);
+    producer(queue, 100, pushed).spawn(executor);
+    executor.run();
+    assert(pushed == 100);
+    assert(received.size() == 100);
+    for (int i = 0; i < 100; ++i) assert(received[i] == i);
+    assert(executor.idle());
+    std::cout << "0\n";
+
+    // Test backpressure when no consumer is running
+    AsyncQueue<int> bounded(executor, 3);
+    int boundedPushed = 0;
+    producer(bounded, 10, boundedPushed).spawn(executor);
+    executor.run();
+    assert(boundedPushed == 3);
+    assert(bounded.size() == 3);
+    assert(bounded.try_pop() == 0);
+    executor.run();
+    assert(boundedPushed == 4);
+    assert(bounded.size() == 3);
+    std::vector<int> rest;
+    consumer(bounded, rest).spawn(executor);
+    executor.run();
+    assert(boundedPushed == 10 && bounded.is_closed());
+    assert(rest.size() == 9 && rest.front() == 1 && rest.back() == 9);
+    std::cout << "1\n";
+
+    // Test batch resumption of waiting consumers
+    AsyncQueue<std::string> strings(executor, 0);
+    std::vector<std::string> got;
+    for (int i = 0; i < 4; ++i) popOnce(strings, got).spawn(executor);
+    executor.run();
+    assert(got.empty());
+    assert(strings.try_push("a"));
+    assert(strings.try_push("b"));
+    assert(strings.try_push("c"));
+    assert(executor.run_once() == 3);
+    assert((got == std::vector<std::string>{"a", "b", "c"}));
+    std::cout << "2\n";
+
+    // Test close wakes waiters and rejects pushes
+    strings.close();
+    executor.run();
+    assert(got.size() == 4 && got[3] == "<closed>");
+    assert(!strings.try_push("d"));
+    AsyncQueue<int> closedQueue(executor, 1);
+    closedQueue.close();
+    bool thrown = false;
+    pushAfterClose(closedQueue, thrown).spawn(executor);
+    executor.run();
+    assert(thrown);
+    std::cout << "3\n";
+
+    // Test an unbuffered queue handing elements from producer to consumer
+    AsyncQueue<int> unbuffered(executor, 0);
+    std::vector<int> handed;
+    int handedPushed = 0;
+    producer(unbuffered, 50, handedPushed).spawn(executor);
+    consumer(unbuffered, handed).spawn(executor);
+    executor.run();
+    assert(handedPushed == 50 && handed.size() == 50 && unbuffered.size() == 0);
+    for (int i = 0; i < 50; ++i) assert(handed[i] == i);
+    AsyncQueue<int> offered(executor, 0);
+    int offeredPushed = 0;
+    producer(offered, 2, offeredPushed).spawn(executor);
+    executor.run();
+    assert(offeredPushed == 0 && !offered.try_push(7));
+    assert(offered.try_pop() == 0 && !offered.try_pop());
+    executor.run();
+    assert(offeredPushed == 1 && offered.try_pop() == 1);
+    executor.run();
+    assert(offeredPushed == 2 && offered.is_closed());
+    std::cout << "4\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
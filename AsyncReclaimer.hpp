@@ -0,0 +1,137 @@
+#ifndef ASYNCRECLAIMER_HPP
+#define ASYNCRECLAIMER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include <utility>
+
+/**
+ * @brief A background thread that frees detached data structures in bounded slices.
+ *
+ * Containers hand over ownership of detached storage as a Task. The reclaimer thread runs every
+ * pending task for at most slice_size units of work at a time, round-robin, so one huge
+ * structure cannot starve the others and each slice has bounded latency. The thread is started
+ * on the first submission and joined, after finishing all pending work, at program exit.
+ */
+class AsyncReclaimer {
+public:
+    /**
+     * @brief A unit of deferred reclamation work.
+     */
+    struct Task {
+        virtual ~Task() = default;
+
+        /**
+         * @brief Frees up to budget units of storage.
+         * @param budget The maximum amount of work to do in this slice.
+         * @return True once the task has freed everything it owns.
+         */
+        virtual bool reclaim(std::size_t budget) = 0;
+    };
+
+    /**
+     * @brief Gets the process-wide reclaimer.
+     * @return Reference to the reclaimer.
+     */
+    static AsyncReclaimer& instance() {
+        static AsyncReclaimer reclaimer;
+        return reclaimer;
+    }
+
+    AsyncReclaimer(const AsyncReclaimer&) = delete;
+    AsyncReclaimer& operator=(const AsyncReclaimer&) = delete;
+
+    /**
+     * @brief Finishes all pending work and stops the background thread.
+     */
+    ~AsyncReclaimer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        work_available.notify_all();
+        if (worker.joinable()) worker.join();
+    }
+
+    /**
+     * @brief Hands a task over to the background thread.
+     * @param task The task to run; ignored if null.
+     */
+    void submit(std::unique_ptr<Task> task) {
+        if (!task) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(std::move(task));
+            if (!worker.joinable()) {
+                worker = std::thread([this] { run(); });
+            }
+        }
+        work_available.notify_one();
+    }
+
+    /**
+     * @brief Blocks until every submitted task has finished.
+     */
+    void wait_idle() {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this] { return tasks.empty() && !busy; });
+    }
+
+    /**
+     * @brief Gets the number of tasks that have not finished yet.
+     * @return The number of pending tasks.
+     */
+    std::size_t pending() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return tasks.size() + (busy ? 1 : 0);
+    }
+
+    /**
+     * @brief Sets the amount of work done per slice.
+     * @param units The maximum units of work per slice; values below 1 are treated as 1.
+     */
+    void set_slice_size(std::size_t units) {
+        std::lock_guard<std::mutex> lock(mutex);
+        slice_size = units ? units : 1;
+    }
+
+private:
+    AsyncReclaimer() : slice_size(4096), busy(false), stopping(false) {}
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            work_available.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) return;
+            std::unique_ptr<Task> task = std::move(tasks.front());
+            tasks.pop_front();
+            std::size_t budget = slice_size;
+            busy = true;
+            lock.unlock();
+            bool done = task->reclaim(budget);
+            if (done) task.reset();
+            lock.lock();
+            busy = false;
+            if (!done) {
+                tasks.push_back(std::move(task));
+            } else if (tasks.empty()) {
+                idle.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex; //!< Guards every member below.
+    std::condition_variable work_available; //!< Signalled on submission and shutdown.
+    std::condition_variable idle; //!< Signalled when the last task finishes.
+    std::deque<std::unique_ptr<Task>> tasks; //!< Pending tasks in round-robin order.
+    std::size_t slice_size; //!< Units of work per slice.
+    bool busy; //!< Whether the worker is running a slice outside the lock.
+    bool stopping; //!< Set when the reclaimer is being destroyed.
+    std::thread worker; //!< The background thread, started lazily.
+};
+
+#endif // ASYNCRECLAIMER_HPP
@@ -0,0 +1,430 @@
+#ifndef COMPRESSEDINTLIST_HPP
+#define COMPRESSEDINTLIST_HPP
+
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <algorithm>
+#include <vector>
+#include <limits>
+#include <initializer_list>
+#include <compare>
+#include <cstring>
+#include "SimdKernels.hpp"
+
+/**
+ * @brief An append-only list of integers stored as delta + varint encoded blocks.
+ *
+ * Elements are grouped into blocks of up to block_capacity values. Each block keeps its first
+ * value verbatim and stores every following value as the zigzag-encoded difference to its
+ * predecessor, written as a LEB128 varint. Sorted or near-sorted sequences therefore take one or
+ * two bytes per element instead of a full list node.
+ *
+ * @tparam T Integral type of elements stored in the list.
+ */
+template<typename T>
+class CompressedIntList {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "CompressedIntList requires an integral element type.");
+
+private:
+    using U = std::make_unsigned_t<T>;
+    using S = std::make_signed_t<U>;
+
+    /**
+     * @brief Bookkeeping for one encoded block.
+     */
+    struct Block {
+        std::size_t offset; //!< Offset of the block's first delta in bytes.
+        T first; //!< First value of the block, stored verbatim.
+        std::uint32_t count; //!< Number of values in the block.
+    };
+
+    std::vector<std::uint8_t> bytes; //!< Encoded deltas of all blocks.
+    std::vector<Block> blocks; //!< Blocks in list order.
+    T last_value; //!< Last value pushed, used as the base of the next delta.
+    std::size_t list_size; //!< Number of elements in the list.
+
+    static U zigzag(U delta) {
+        S s = static_cast<S>(delta);
+        return static_cast<U>(static_cast<U>(static_cast<U>(s) << 1) ^ static_cast<U>(s >> (std::numeric_limits<U>::digits - 1)));
+    }
+
+    static U unzigzag(U z) {
+        return static_cast<U>(static_cast<U>(z >> 1) ^ static_cast<U>(U(0) - static_cast<U>(z & 1u)));
+    }
+
+    static T apply_delta(T base, const std::uint8_t*& pos) {
+        U z = 0;
+        unsigned shift = 0;
+        std::uint8_t byte;
+        do {
+            byte = *pos++;
+            z = static_cast<U>(z | static_cast<U>(static_cast<U>(byte & 0x7Fu) << shift));
+            shift += 7;
+        } while (byte & 0x80u);
+        return static_cast<T>(static_cast<U>(static_cast<U>(base) + unzigzag(z)));
+    }
+
+    /**
+     * @brief Checks whether a block holds the same encoding as the block at the same index of another list.
+     */
+    bool same_block(std::size_t index, const CompressedIntList& other) const {
+        const Block& mine = blocks[index];
+        const Block& theirs = other.blocks[index];
+        std::size_t length = (index + 1 < blocks.size() ? blocks[index + 1].offset : bytes.size()) - mine.offset;
+        std::size_t otherLength = (index + 1 < other.blocks.size() ? other.blocks[index + 1].offset : other.bytes.size()) - theirs.offset;
+        return mine.first == theirs.first && mine.count == theirs.count && length == otherLength
+            && (length == 0 || std::memcmp(bytes.data() + mine.offset, other.bytes.data() + theirs.offset, length) == 0);
+    }
+
+    void append_delta(U z) {
+        while (z >= 0x80u) {
+            bytes.push_back(static_cast<std::uint8_t>(z | 0x80u));
+            z = static_cast<U>(z >> 7);
+        }
+        bytes.push_back(static_cast<std::uint8_t>(z));
+    }
+
+public:
+    using value_type = T;
+    using reference = const T&;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+
+    static constexpr std::size_t block_capacity = 128; //!< Maximum number of values per block.
+
+    /**
+     * @brief Default constructor for CompressedIntList.
+     */
+    CompressedIntList() : last_value(), list_size(0) {}
+
+    /**
+     * @brief Constructs a CompressedIntList from a range of iterators.
+     * @param first The start iterator of the range.
+     * @param last The end iterator of the range.
+     */
+    template<typename InputIt>
+    CompressedIntList(InputIt first, InputIt last) : CompressedIntList() {
+        std::for_each(first, last, [this](const T& value) { push_back(value); });
+    }
+
+    /**
+     * @brief Constructs a CompressedIntList from an initializer list.
+     * @param initList The initializer list.
+     */
+    CompressedIntList(std::initializer_list<T> initList) : CompressedIntList(initList.begin(), initList.end()) {}
+
+    /**
+     * @brief Check if the CompressedIntList is empty.
+     * @return True if the CompressedIntList is empty, false if not.
+     */
+    bool empty() const { return list_size == 0; }
+
+    /**
+     * @brief Gets the number of elements in the list.
+     * @return The number of elements.
+     */
+    std::size_t size() const { return list_size; }
+
+    /**
+     * @brief Gets the number of encoded blocks.
+     * @return The number of blocks.
+     */
+    std::size_t block_count() const { return blocks.size(); }
+
+    /**
+     * @brief Adds a new element to the end of the list.
+     * @param value The value to add.
+     */
+    void push_back(T value) {
+        if (blocks.empty() || blocks.back().count == block_capacity) {
+            blocks.push_back(Block{bytes.size(), value, 1});
+        } else {
+            append_delta(zigzag(static_cast<U>(static_cast<U>(value) - static_cast<U>(last_value))));
+            ++blocks.back().count;
+        }
+        last_value = value;
+        ++list_size;
+    }
+
+    /**
+     * @brief Adds a new element to the end of the list.
+     * @param value The value to add.
+     */
+    void push(T value) {
+        push_back(value);
+    }
+
+    /**
+     * @brief Retrieves the first element of the list.
+     * @return The first element.
+     * @throws std::runtime_error if the list is empty.
+     */
+    T front() const {
+        if (blocks.empty()) {
+            throw std::runtime_error("List is empty: cannot access head.");
+        }
+        return blocks.front().first;
+    }
+
+    /**
+     * @brief Retrieves the last element of the list.
+     * @return The last element.
+     * @throws std::runtime_error if the list is empty.
+     */
+    T back() const {
+        if (blocks.empty()) {
+            throw std::runtime_error("List is empty: cannot access tail.");
+        }
+        return last_value;
+    }
+
+    /**
+     * @brief Clears the list.
+     */
+    void clear() {
+        bytes.clear();
+        blocks.clear();
+        last_value = T();
+        list_size = 0;
+    }
+
+    /**
+     * @brief Releases unused capacity of the encoded storage.
+     */
+    void shrink_to_fit() {
+        bytes.shrink_to_fit();
+        blocks.shrink_to_fit();
+    }
+
+    /**
+     * @brief Gets the number of bytes held by the list, including unused capacity.
+     * @return The memory footprint in bytes.
+     */
+    std::size_t memory_usage() const {
+        return sizeof(*this) + bytes.capacity() + blocks.capacity() * sizeof(Block);
+    }
+
+    /**
+     * @brief Decodes one block into caller-provided storage.
+     * @param index The index of the block.
+     * @param out Pointer to storage for at least block_capacity values.
+     * @return The number of values written.
+     * @throws std::out_of_range if the index is out of range.
+     */
+    std::size_t decode_block(std::size_t index, T* out) const {
+        if (index >= blocks.size()) throw std::out_of_range("Block index out of range");
+        const Block& block = blocks[index];
+        const std::uint8_t* pos = bytes.data() + block.offset;
+        T value = block.first;
+        out[0] = value;
+        for (std::uint32_t i = 1; i < block.count; ++i) {
+            value = apply_delta(value, pos);
+            out[i] = value;
+        }
+        return block.count;
+    }
+
+    /**
+     * @brief Decodes the list block by block and passes each decoded chunk to a callback.
+     * @param fn Callable invoked as fn(const T* data, std::size_t count) for every block in order.
+     */
+    template<typename Fn>
+    void for_each_block(Fn fn) const {
+        T buffer[block_capacity];
+        for (std::size_t b = 0; b < blocks.size(); ++b) {
+            std::size_t n = decode_block(b, buffer);
+            fn(static_cast<const T*>(buffer), n);
+        }
+    }
+
+    /**
+     * @brief Sums all elements, wrapping around on overflow.
+     * @return The sum of the elements.
+     */
+    T sum() const {
+        T total = T();
+        for_each_block([&total](const T* data, std::size_t n) {
+            total = simd::detail::wrapping_add(total, simd::sum(data, data + n));
+        });
+        return total;
+    }
+
+    /**
+     * @brief Counts the elements equal to a value.
+     * @param value The value to count.
+     * @return The number of matching elements.
+     */
+    std::size_t count(T value) const {
+        std::size_t total = 0;
+        for_each_block([&total, value](const T* data, std::size_t n) {
+            total += simd::count(data, data + n, value);
+        });
+        return total;
+    }
+
+    /**
+     * @brief Converts the list to a std::vector.
+     * @return A std::vector containing the list elements.
+     */
+    std::vector<T> to_vector() const {
+        std::vector<T> vec(list_size);
+        T* out = vec.data();
+        for (std::size_t b = 0; b < blocks.size(); ++b) {
+            out += decode_block(b, out);
+        }
+        return vec;
+    }
+
+    /**
+     * @brief Check if this list is equal to another list.
+     * @param other The list to be compared with this list.
+     * @return Whether the two lists are equal.
+     */
+    bool operator==(const CompressedIntList& other) const {
+        if (this == &other) return true;
+        return list_size == other.list_size && bytes == other.bytes && std::equal(blocks.begin(), blocks.end(), other.blocks.begin(),
+            [](const Block& a, const Block& b) { return a.first == b.first && a.count == b.count; });
+    }
+
+    /**
+     * @brief Check if this list is not equal to another list.
+     * @param other The list to be compared with this list.
+     * @return Whether the two lists are not equal.
+     */
+    bool operator!=(const CompressedIntList& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Compares two lists lexicographically.
+     *
+     * Every block but the last holds block_capacity values, so the blocks of two lists line up
+     * by index, and equal values are encoded to equal bytes. Blocks whose encodings match are
+     * skipped with a memcmp; only the first differing block is decoded and compared.
+     *
+     * @param other The list to be compared with this list.
+     * @return The ordering of this list relative to other.
+     */
+    std::strong_ordering operator<=>(const CompressedIntList& other) const {
+        if (this == &other) return std::strong_ordering::equal;
+        std::size_t common = std::min(blocks.size(), other.blocks.size());
+        for (std::size_t b = 0; b < common; ++b) {
+            if (same_block(b, other)) continue;
+            T mine[block_capacity];
+            T theirs[block_capacity];
+            std::size_t n = decode_block(b, mine);
+            std::size_t m = other.decode_block(b, theirs);
+            std::strong_ordering order = std::lexicographical_compare_three_way(mine, mine + n, theirs, theirs + m);
+            if (order != 0) return order;
+        }
+        return list_size <=> other.list_size;
+    }
+
+    /**
+     * @brief Iterator decoding one element per step.
+     *
+     * The element is decoded into the iterator, so it is returned by value: a reference would
+     * dangle once the iterator is advanced or destroyed. That makes it a legacy input iterator,
+     * but copies can be advanced independently, so it models std::forward_iterator.
+     */
+    class ConstIterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        /**
+         * @brief Constructs a singular iterator.
+         */
+        ConstIterator() : list(nullptr), pos(nullptr), value(), block(0), remaining(0), index(0) {}
+
+        /**
+         * @brief Constructs an iterator at the given element index.
+         * @param owner The list being iterated.
+         * @param start Either 0 for the first element or size() for the end.
+         */
+        ConstIterator(const CompressedIntList* owner, std::size_t start) : list(owner), pos(nullptr), value(), block(0), remaining(0), index(start) {
+            if (index < list->list_size) enter_block(0);
+        }
+
+        /**
+         * @brief Dereferences the iterator to access the current element.
+         * @return The current element.
+         */
+        T operator*() const { return value; }
+
+        /**
+         * @brief Advances the iterator to the next element.
+         * @return Reference to this iterator.
+         */
+        ConstIterator& operator++() {
+            ++index;
+            if (--remaining > 0) {
+                value = apply_delta(value, pos);
+            } else if (index < list->list_size) {
+                enter_block(block + 1);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Advances the iterator to the next element (postfix).
+         * @return The previous state of the iterator.
+         */
+        ConstIterator operator++(int) {
+            ConstIterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        /**
+         * @brief Checks if two iterators are equal.
+         * @param other The other iterator to compare with.
+         * @return True if the iterators are equal, false otherwise.
+         */
+        bool operator==(const ConstIterator& other) const { return index == other.index; }
+
+        /**
+         * @brief Checks if two iterators are not equal.
+         * @param other The other iterator to compare with.
+         * @return True if the iterators are not equal, false otherwise.
+         */
+        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+
+    private:
+        void enter_block(std::size_t b) {
+            block = b;
+            const Block& blk = list->blocks[b];
+            pos = list->bytes.data() + blk.offset;
+            value = blk.first;
+            remaining = blk.count;
+        }
+
+        const CompressedIntList* list; //!< The list being iterated.
+        const std::uint8_t* pos; //!< Next delta to decode.
+        T value; //!< Current decoded element.
+        std::size_t block; //!< Index of the current block.
+        std::uint32_t remaining; //!< Elements left in the current block, including this one.
+        std::size_t index; //!< Index of the current element.
+    };
+
+    /**
+     * @brief Gets a const iterator to the beginning of the list.
+     * @return A ConstIterator pointing to the first element.
+     */
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+
+    /**
+     * @brief Gets a const iterator to the end of the list.
+     * @return A ConstIterator pointing to one past the last element.
+     */
+    ConstIterator end() const { return ConstIterator(this, list_size); }
+};
+
+#endif // COMPRESSEDINTLIST_HPP
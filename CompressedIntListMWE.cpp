@@ -0,0 +1,125 @@
+#include "CompressedIntList.hpp"
+#include "SinglyLinkedList.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+int main() {
+    std::cout << "CompressedIntList MWE test starts!\n";
+
+    // Test push and access operations
+    CompressedIntList<std::uint64_t> ids;
+    assert(ids.empty());
+    ids.push_back(100);
+    ids.push_back(101);
+    ids.push(105);
+    assert(ids.size() == 3);
+    assert(ids.front() == 100);
+    assert(ids.back() == 105);
+    std::cout << "0\n";
+
+    // Test round trip of a sorted sequence spanning many blocks
+    std::vector<std::uint64_t> sorted;
+    std::uint64_t id = 1000000000000ull;
+    for (std::size_t i = 0; i < 10000; ++i) {
+        id += 1 + (i * 7) % 13;
+        sorted.push_back(id);
+    }
+    CompressedIntList<std::uint64_t> big(sorted.begin(), sorted.end());
+    assert(big.size() == sorted.size());
+    assert(big.block_count() == (sorted.size() + CompressedIntList<std::uint64_t>::block_capacity - 1) / CompressedIntList<std::uint64_t>::block_capacity);
+    assert(big.to_vector() == sorted);
+    std::vector<std::uint64_t> iterated(big.begin(), big.end());
+    assert(iterated == sorted);
+    std::cout << "1\n";
+
+    // Test that sorted ids take far less memory than list nodes
+    big.shrink_to_fit();
+    assert(big.memory_usage() * 5 < sorted.size() * (sizeof(std::uint64_t) + sizeof(std::shared_ptr<int>)));
+    std::cout << "2\n";
+
+    // Test signed values and extreme deltas
+    CompressedIntList<std::int32_t> signedList = {0, -1, std::numeric_limits<std::int32_t>::max(), std::numeric_limits<std::int32_t>::min(), 5, 5, -7};
+    std::vector<std::int32_t> expected = {0, -1, std::numeric_limits<std::int32_t>::max(), std::numeric_limits<std::int32_t>::min(), 5, 5, -7};
+    assert(signedList.to_vector() == expected);
+    CompressedIntList<std::uint8_t> bytes = {255, 0, 128, 1};
+    assert((bytes.to_vector() == std::vector<std::uint8_t>{255, 0, 128, 1}));
+    std::cout << "3\n";
+
+    // Test block-wise decoding and reductions
+    std::size_t seen = 0;
+    big.for_each_block([&seen, &sorted](const std::uint64_t* data, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) assert(data[i] == sorted[seen + i]);
+        seen += n;
+    });
+    assert(seen == sorted.size());
+    assert(big.sum() == std::accumulate(sorted.begin(), sorted.end(), std::uint64_t(0)));
+    assert(big.count(sorted[1234]) == 1);
+    assert(signedList.count(5) == 2);
+    std::vector<std::int32_t> large(300, 16000000);
+    CompressedIntList<std::int32_t> overflowing(large.begin(), large.end());
+    assert(overflowing.sum() == static_cast<std::int32_t>(300u * static_cast<std::uint32_t>(large[0])));
+    std::cout << "4\n";
+
+    // Test equality and clear
+    CompressedIntList<std::uint64_t> copy(sorted.begin(), sorted.end());
+    assert(copy == big);
+    copy.push_back(1);
+    assert(copy != big);
+    copy.clear();
+    assert(copy.empty());
+    bool thrown = false;
+    try {
+        copy.front();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "5\n";
+
+    // Test conversion from a SinglyLinkedList
+    SinglyLinkedList<std::uint64_t> list = {3, 1, 4, 1, 5, 9, 2, 6};
+    CompressedIntList<std::uint64_t> fromList(list.begin(), list.end());
+    assert(fromList.to_vector() == list.to_vector());
+    std::cout << "6\n";
+
+    // Test three-way comparison against comparing the decoded vectors
+    std::vector<int> base(1000);
+    std::iota(base.begin(), base.end(), -300);
+    CompressedIntList<int> reference(base.begin(), base.end());
+    assert((reference <=> reference) == 0);
+    for (std::size_t at : {std::size_t(0), std::size_t(127), std::size_t(128), std::size_t(640), std::size_t(999)}) {
+        for (int delta : {-1, 1, 100000}) {
+            std::vector<int> changed = base;
+            changed[at] += delta;
+            CompressedIntList<int> other(changed.begin(), changed.end());
+            assert((other <=> reference) == (changed <=> base));
+            assert((reference <=> other) == (base <=> changed));
+        }
+    }
+    std::vector<int> shorter(base.begin(), base.begin() + 640);
+    CompressedIntList<int> prefix(shorter.begin(), shorter.end());
+    assert((prefix <=> reference) < 0 && (reference <=> prefix) > 0 && prefix < reference);
+    assert((CompressedIntList<int>() <=> CompressedIntList<int>()) == 0 && CompressedIntList<int>() < prefix);
+    std::cout << "7\n";
+
+    // Test that decoded elements outlive the iterator that produced them
+    using It = CompressedIntList<int>::ConstIterator;
+    static_assert(std::forward_iterator<It>);
+    static_assert(std::is_same_v<std::iterator_traits<It>::iterator_category, std::input_iterator_tag>);
+    auto it = reference.begin();
+    auto&& first = *it++;
+    ++it;
+    assert(first == -300 && *it == -298);
+    assert(*std::ranges::max_element(reference) == 699);
+    std::cout << "8\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
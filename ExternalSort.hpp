@@ -0,0 +1,224 @@
+#ifndef EXTERNALSORT_HPP
+#define EXTERNALSORT_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "SinglyLinkedList.hpp"
+#include "SpillFile.hpp"
+
+/**
+ * @brief External merge sort for sequences larger than memory.
+ *
+ * The input is cut into runs that fit the memory budget. Each run is collected into a
+ * SinglyLinkedList, sorted there by relinking its nodes, written sequentially to a temporary
+ * file and freed. The runs are then merged k-way, each run read back through a buffer of
+ * roughly memory_budget / k bytes. At no point does the sort hold more than about one budget of
+ * elements in memory, unlike copying into a vector for std::sort. If the whole input fits in
+ * one run, nothing is written to disk. The sort is stable.
+ */
+namespace external_sort_detail {
+
+/**
+ * @brief Sorted runs written back to back into one spill file.
+ * @tparam T Type of the elements; must be trivially copyable.
+ */
+template<typename T>
+class SortedRuns {
+public:
+    /**
+     * @brief Creates the spill file.
+     * @param memoryBudget The number of bytes of elements to hold in memory.
+     * @param directory The directory for the spill file; the system temp directory if empty.
+     */
+    SortedRuns(std::size_t memoryBudget, const std::string& directory)
+        : file(directory), budget(std::max<std::size_t>(memoryBudget / sizeof(T), 1)) {}
+
+    /**
+     * @brief Gets the number of runs written.
+     * @return The run count.
+     */
+    std::size_t size() const { return runs.size(); }
+
+    /**
+     * @brief Writes a sorted run to the file in blocks.
+     * @param run The sorted run.
+     */
+    template<typename List>
+    void add(const List& run) {
+        std::vector<T> block;
+        block.reserve(std::min<std::size_t>(run.size(), write_block));
+        std::size_t position = file.size();
+        for (const T& value : run) {
+            block.push_back(value);
+            if (block.size() == write_block) {
+                file.append(block.data(), block.size());
+                block.clear();
+            }
+        }
+        if (!block.empty()) file.append(block.data(), block.size());
+        runs.push_back(Run{position, position + run.size()});
+    }
+
+    /**
+     * @brief Merges every run into an output iterator.
+     * @param out The destination.
+     * @param comp The strict weak ordering the runs are sorted by.
+     * @return The output iterator past the last element written.
+     */
+    template<typename OutputIt, typename Compare>
+    OutputIt merge(OutputIt out, Compare& comp) {
+        std::size_t block = std::max<std::size_t>(budget / std::max<std::size_t>(runs.size(), 1), 1);
+        std::vector<Cursor> cursors;
+        cursors.reserve(runs.size());
+        for (const Run& run : runs) {
+            cursors.push_back(Cursor{run.begin, run.end, {}, 0});
+            refill(cursors.back(), block);
+        }
+        // Max-heap on "comes later": ties are broken by run index so that the merge is stable.
+        auto later = [&](std::size_t a, std::size_t b) {
+            const T& x = cursors[a].current();
+            const T& y = cursors[b].current();
+            if (comp(y, x)) return true;
+            if (comp(x, y)) return false;
+            return a > b;
+        };
+        std::vector<std::size_t> heap;
+        for (std::size_t i = 0; i < cursors.size(); ++i) {
+            if (!cursors[i].exhausted()) heap.push_back(i);
+        }
+        std::make_heap(heap.begin(), heap.end(), later);
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), later);
+            Cursor& cursor = cursors[heap.back()];
+            *out = cursor.current();
+            ++out;
+            if (++cursor.index == cursor.buffer.size()) refill(cursor, block);
+            if (cursor.exhausted()) {
+                heap.pop_back();
+            } else {
+                std::push_heap(heap.begin(), heap.end(), later);
+            }
+        }
+        return out;
+    }
+
+private:
+    struct Run {
+        std::size_t begin; //!< Position of the first element in the file.
+        std::size_t end; //!< Position past the last element in the file.
+    };
+
+    struct Cursor {
+        std::size_t next; //!< Position of the first element not yet read.
+        std::size_t end; //!< Position past the run's last element.
+        std::vector<T> buffer; //!< Elements read but not yet merged.
+        std::size_t index; //!< Index of the current element in the buffer.
+
+        const T& current() const { return buffer[index]; }
+        bool exhausted() const { return index == buffer.size(); }
+    };
+
+    static constexpr std::size_t write_block = 1 << 16; //!< Elements per sequential write.
+
+    void refill(Cursor& cursor, std::size_t block) {
+        std::size_t count = std::min(block, cursor.end - cursor.next);
+        cursor.buffer.resize(count);
+        if (count > 0) file.read(cursor.next, cursor.buffer.data(), count);
+        cursor.next += count;
+        cursor.index = 0;
+    }
+
+    SpillFile<T> file; //!< The runs, back to back.
+    std::vector<Run> runs; //!< The runs, in input order.
+    std::size_t budget; //!< Number of elements to hold in memory.
+};
+
+/**
+ * @brief Gets the number of list elements that fit the memory budget.
+ * @param memoryBudget The number of bytes available.
+ * @return The run length; at least 1.
+ */
+template<typename T>
+std::size_t run_length(std::size_t memoryBudget) {
+    // A node holds the value, the next pointer and the shared_ptr control block.
+    return std::max<std::size_t>(memoryBudget / (sizeof(T) + 4 * sizeof(void*)), 1);
+}
+
+} // namespace external_sort_detail
+
+/**
+ * @brief Sorts a sequence larger than memory into an output iterator.
+ *
+ * The input is read once, a run at a time, so it may be a stream or a SpillingList.
+ *
+ * @param first The start of the input.
+ * @param last The end of the input.
+ * @param out The destination.
+ * @param comp The strict weak ordering.
+ * @param memoryBudget The number of bytes of elements to hold in memory.
+ * @param tmpdir The directory for the temporary file; the system temp directory if empty.
+ * @return The output iterator past the last element written.
+ * @throws std::runtime_error if the temporary file cannot be created, written or read.
+ */
+template<typename InputIt, typename OutputIt, typename Compare>
+OutputIt external_sort(InputIt first, InputIt last, OutputIt out, Compare comp, std::size_t memoryBudget,
+                       const std::string& tmpdir = "") {
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    static_assert(std::is_trivially_copyable_v<T>, "external_sort requires a trivially copyable type.");
+    std::size_t runLength = external_sort_detail::run_length<T>(memoryBudget);
+    SinglyLinkedList<T> run;
+    std::optional<external_sort_detail::SortedRuns<T>> runs;
+    while (first != last) {
+        while (first != last && run.size() < runLength) {
+            run.push_back(*first);
+            ++first;
+        }
+        run.sort(comp);
+        if (first == last && !runs) {
+            return std::copy(run.begin(), run.end(), out);
+        }
+        if (!runs) runs.emplace(memoryBudget, tmpdir);
+        runs->add(run);
+        run.clear();
+    }
+    if (!runs) return out;
+    return runs->merge(out, comp);
+}
+
+/**
+ * @brief Sorts a SinglyLinkedList larger than memory, in place.
+ *
+ * Runs are detached from the front of the list with take_front(), so the list gives its memory
+ * back while the runs are written, and is rebuilt by the merge. A list that fits in one run is
+ * simply sorted by relinking.
+ *
+ * @param list The list to sort.
+ * @param comp The strict weak ordering.
+ * @param memoryBudget The number of bytes of elements to hold in memory.
+ * @param tmpdir The directory for the temporary file; the system temp directory if empty.
+ * @throws std::runtime_error if the temporary file cannot be created, written or read.
+ */
+template<typename T, typename Allocator, typename Compare>
+void external_sort(SinglyLinkedList<T, Allocator>& list, Compare comp, std::size_t memoryBudget, const std::string& tmpdir = "") {
+    static_assert(std::is_trivially_copyable_v<T>, "external_sort requires a trivially copyable type.");
+    std::size_t runLength = external_sort_detail::run_length<T>(memoryBudget);
+    if (list.size() <= runLength) {
+        list.sort(comp);
+        return;
+    }
+    external_sort_detail::SortedRuns<T> runs(memoryBudget, tmpdir);
+    while (!list.empty()) {
+        SinglyLinkedList<T, Allocator> run = list.take_front(std::min(runLength, list.size()));
+        run.sort(comp);
+        runs.add(run);
+    }
+    runs.merge(std::back_inserter(list), comp);
+}
+
+#endif // EXTERNALSORT_HPP
@@ -0,0 +1,66 @@
+#include "ExternalSort.hpp"
+#include "SpillingList.hpp"
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <sstream>
+#include <functional>
+
+struct Keyed {
+    int key;
+    int order;
+};
+
+int main() {
+    std::cout << "ExternalSort MWE test starts!\n";
+
+    // Test a list that fits in one run is sorted in memory
+    SinglyLinkedList<int> small = {5, 3, 9, 1};
+    external_sort(small, std::less<>(), 1 << 20);
+    assert((small == SinglyLinkedList<int>{1, 3, 5, 9}));
+    std::cout << "0\n";
+
+    // Test a list many times the budget is sorted through runs on disk
+    std::mt19937 rng(42);
+    SinglyLinkedList<std::uint32_t> big;
+    for (int i = 0; i < 100000; ++i) big.push_back(rng() % 50000);
+    std::vector<std::uint32_t> expected = big.to_vector();
+    std::sort(expected.begin(), expected.end());
+    external_sort(big, std::less<>(), 64 * 1024);
+    assert(big.size() == 100000 && big.to_vector() == expected && big.back() == expected.back());
+    external_sort(big, std::greater<>(), 64 * 1024);
+    assert(big.front() == expected.back() && big.back() == expected.front());
+    std::cout << "1\n";
+
+    // Test the merge is stable across runs
+    SinglyLinkedList<Keyed> pairs;
+    for (int i = 0; i < 20000; ++i) pairs.push_back({i % 3, i});
+    external_sort(pairs, [](const Keyed& a, const Keyed& b) { return a.key < b.key; }, 16 * 1024);
+    int last = -1, group = 0;
+    for (const auto& [key, order] : pairs) {
+        if (key != group) { group = key; last = -1; }
+        assert(order > last);
+        last = order;
+    }
+    assert(pairs.front().key == 0 && pairs.back().key == 2);
+    std::cout << "2\n";
+
+    // Test streamed and spilled inputs into output iterators
+    std::istringstream stream("9 4 7 1 8 2 6 3 5 0");
+    std::vector<int> fromStream;
+    external_sort(std::istream_iterator<int>(stream), std::istream_iterator<int>(), std::back_inserter(fromStream),
+                  std::less<>(), 2 * sizeof(int));
+    assert((fromStream == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    SpillingList<long> spilled(1024 * sizeof(long), 256);
+    for (long i = 0; i < 20000; ++i) spilled.push_back((i * 7331) % 20000);
+    assert(spilled.spilled_size() > 0);
+    SpillingList<long> sorted(1024 * sizeof(long), 256);
+    external_sort(spilled.begin(), spilled.end(), std::back_inserter(sorted), std::less<>(), 8 * 1024);
+    long next = 0;
+    for (long x : sorted) assert(x == next++);
+    assert(next == 20000);
+    std::cout << "3\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
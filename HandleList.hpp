@@ -0,0 +1,392 @@
+#ifndef HANDLELIST_HPP
+#define HANDLELIST_HPP
+
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A compact, copyable reference to an element of a HandleList.
+ *
+ * A handle is a slot index and the generation of the slot when the element was inserted. Erasing
+ * the element bumps the generation, so a handle kept past the erase is detected as stale in O(1)
+ * even after the slot has been reused. A default-constructed handle refers to no element.
+ */
+struct NodeHandle {
+    static constexpr std::uint32_t null_slot = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t slot = null_slot; //!< Index of the element's slot.
+    std::uint32_t generation = 0; //!< Generation of the slot when the element was inserted.
+
+    /**
+     * @brief Checks if the handle refers to no element.
+     * @return True for a default-constructed handle, false otherwise.
+     */
+    bool null() const { return slot == null_slot; }
+
+    friend bool operator==(const NodeHandle&, const NodeHandle&) = default;
+};
+
+/**
+ * @brief A singly linked list whose elements are addressed by generation-checked handles.
+ *
+ * Nodes live in a slot table and link to each other by index, and erased slots are kept on a
+ * free chain for reuse. Handles stay valid across every other insertion and erase, and
+ * contains(), insert_after() and erase_after() check and follow a handle in O(1) instead of
+ * searching from the head like SinglyLinkedList::insert_before() and erase_before(). References
+ * to elements are invalidated when the table grows; handles are not, and reserve() avoids the
+ * growth.
+ *
+ * @tparam T Type of elements stored in the list.
+ */
+template<typename T>
+class HandleList {
+private:
+    static constexpr std::uint32_t npos = NodeHandle::null_slot;
+
+    /**
+     * @brief A slot of the table, holding an element or a link in the free chain.
+     */
+    struct Slot {
+        std::optional<T> value; //!< The element; empty while the slot is free.
+        std::uint32_t next = npos; //!< Next slot of the list, or of the free chain.
+        std::uint32_t generation = 0; //!< Bumped each time the slot's element is erased.
+    };
+
+    std::vector<Slot> slots; //!< The slot table.
+    std::uint32_t head = npos; //!< Slot of the first element.
+    std::uint32_t tail = npos; //!< Slot of the last element.
+    std::uint32_t free_head = npos; //!< First slot of the free chain.
+    std::size_t list_size = 0; //!< Number of elements in the list.
+
+    /**
+     * @brief Stores a value in a free slot, growing the table if there is none.
+     * @param val The value to store.
+     * @return The index of the slot; its link is not set.
+     */
+    std::uint32_t acquire(T&& val) {
+        if (free_head == npos) {
+            if (slots.size() >= npos) {
+                throw std::length_error("HandleList is full.");
+            }
+            slots.emplace_back();
+            free_head = static_cast<std::uint32_t>(slots.size() - 1);
+        }
+        std::uint32_t index = free_head;
+        slots[index].value.emplace(std::move(val));
+        free_head = slots[index].next;
+        slots[index].next = npos;
+        return index;
+    }
+
+    /**
+     * @brief Destroys the element of a slot and puts the slot on the free chain.
+     * @param index The slot to free.
+     */
+    void release(std::uint32_t index) {
+        Slot& slot = slots[index];
+        slot.value.reset();
+        ++slot.generation;
+        slot.next = free_head;
+        free_head = index;
+    }
+
+    /**
+     * @brief Resolves a handle to its slot.
+     * @param handle The handle to check.
+     * @return The index of the slot.
+     * @throws std::runtime_error if the handle is null or stale.
+     */
+    std::uint32_t checked_slot(NodeHandle handle) const {
+        if (!contains(handle)) {
+            throw std::runtime_error("Stale node handle.");
+        }
+        return handle.slot;
+    }
+
+    /**
+     * @brief Builds the handle of an occupied slot.
+     * @param index The slot, or npos.
+     * @return The handle, or a null handle for npos.
+     */
+    NodeHandle handle_of(std::uint32_t index) const {
+        return index == npos ? NodeHandle{} : NodeHandle{index, slots[index].generation};
+    }
+
+    /**
+     * @brief Forward iterator over the elements, in list order.
+     * @tparam Const Whether the iterator gives read-only access.
+     */
+    template<bool Const>
+    class BasicIterator {
+    public:
+        using Owner = std::conditional_t<Const, const HandleList, HandleList>;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        /**
+         * @brief Constructs a singular iterator.
+         */
+        BasicIterator() : list(nullptr), index(npos) {}
+
+        /**
+         * @brief Constructs an iterator at the given slot.
+         * @param owner The list iterated over.
+         * @param slot The slot, or npos for the end.
+         */
+        BasicIterator(Owner* owner, std::uint32_t slot) : list(owner), index(slot) {}
+
+        /**
+         * @brief Converts a mutable iterator to a read-only one.
+         * @param other The iterator to convert.
+         */
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) : list(other.list), index(other.index) {}
+
+        reference operator*() const { return *list->slots[index].value; }
+        pointer operator->() const { return &*list->slots[index].value; }
+
+        BasicIterator& operator++() {
+            index = list->slots[index].next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        /**
+         * @brief Gets the handle of the element the iterator points to.
+         * @return The handle, or a null handle for the end.
+         */
+        NodeHandle handle() const { return list ? list->handle_of(index) : NodeHandle{}; }
+
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) { return a.index == b.index; }
+
+    private:
+        template<bool> friend class BasicIterator;
+
+        Owner* list; //!< The list iterated over.
+        std::uint32_t index; //!< The current slot, or npos at the end.
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    /**
+     * @brief Default constructor for HandleList.
+     */
+    HandleList() = default;
+
+    /**
+     * @brief Checks if the list is empty.
+     * @return True if the list is empty, false otherwise.
+     */
+    bool empty() const { return list_size == 0; }
+
+    /**
+     * @brief Gets the size of the list.
+     * @return The number of elements in the list.
+     */
+    std::size_t size() const { return list_size; }
+
+    /**
+     * @brief Gets the number of elements the list can hold without growing its slot table.
+     * @return The number of slots.
+     */
+    std::size_t capacity() const { return slots.capacity(); }
+
+    /**
+     * @brief Grows the slot table so that the list holds n elements without reallocating.
+     * @param n The number of elements to make room for.
+     */
+    void reserve(std::size_t n) { slots.reserve(n); }
+
+    /**
+     * @brief Checks in O(1) if a handle refers to an element of the list.
+     * @param handle The handle to check.
+     * @return False if the handle is null, stale or from a slot the list does not have.
+     */
+    bool contains(NodeHandle handle) const {
+        return handle.slot < slots.size() && slots[handle.slot].generation == handle.generation && slots[handle.slot].value.has_value();
+    }
+
+    /**
+     * @brief Accesses the element of a handle.
+     * @param handle The handle of the element.
+     * @return A reference to the element.
+     * @throws std::runtime_error if the handle is null or stale.
+     */
+    T& operator[](NodeHandle handle) { return *slots[checked_slot(handle)].value; }
+
+    /**
+     * @brief Accesses the element of a handle.
+     * @param handle The handle of the element.
+     * @return A const reference to the element.
+     * @throws std::runtime_error if the handle is null or stale.
+     */
+    const T& operator[](NodeHandle handle) const { return *slots[checked_slot(handle)].value; }
+
+    /**
+     * @brief Gets the handle of the first element.
+     * @return The handle, or a null handle if the list is empty.
+     */
+    NodeHandle front_handle() const { return handle_of(head); }
+
+    /**
+     * @brief Gets the handle of the last element.
+     * @return The handle, or a null handle if the list is empty.
+     */
+    NodeHandle back_handle() const { return handle_of(tail); }
+
+    /**
+     * @brief Gets the handle of the element following another one.
+     * @param handle The handle of the element.
+     * @return The handle of the next element, or a null handle after the last one.
+     * @throws std::runtime_error if the handle is null or stale.
+     */
+    NodeHandle next(NodeHandle handle) const { return handle_of(slots[checked_slot(handle)].next); }
+
+    /**
+     * @brief Retrieves the first element.
+     * @return A reference to the first element.
+     * @throws std::runtime_error if the list is empty.
+     */
+    T& front() {
+        if (head == npos) {
+            throw std::runtime_error("List is empty: cannot access head.");
+        }
+        return *slots[head].value;
+    }
+
+    /**
+     * @brief Retrieves the last element.
+     * @return A reference to the last element.
+     * @throws std::runtime_error if the list is empty.
+     */
+    T& back() {
+        if (tail == npos) {
+            throw std::runtime_error("List is empty: cannot access tail.");
+        }
+        return *slots[tail].value;
+    }
+
+    /**
+     * @brief Adds an element to the front of the list.
+     * @param val The value to add.
+     * @return The handle of the new element.
+     */
+    NodeHandle push_front(T val) {
+        std::uint32_t index = acquire(std::move(val));
+        slots[index].next = head;
+        head = index;
+        if (tail == npos) tail = index;
+        ++list_size;
+        return handle_of(index);
+    }
+
+    /**
+     * @brief Adds an element to the end of the list.
+     * @param val The value to add.
+     * @return The handle of the new element.
+     */
+    NodeHandle push_back(T val) {
+        std::uint32_t index = acquire(std::move(val));
+        if (tail == npos) {
+            head = index;
+        } else {
+            slots[tail].next = index;
+        }
+        tail = index;
+        ++list_size;
+        return handle_of(index);
+    }
+
+    /**
+     * @brief Inserts a new element after the element of a handle in O(1).
+     * @param pos The handle of the element after which to insert.
+     * @param val The value to insert.
+     * @return The handle of the new element.
+     * @throws std::runtime_error if pos is null or stale.
+     */
+    NodeHandle insert_after(NodeHandle pos, T val) {
+        std::uint32_t before = checked_slot(pos);
+        std::uint32_t index = acquire(std::move(val));
+        slots[index].next = slots[before].next;
+        slots[before].next = index;
+        if (before == tail) tail = index;
+        ++list_size;
+        return handle_of(index);
+    }
+
+    /**
+     * @brief Erases the element after the element of a handle in O(1).
+     *
+     * The handle of the erased element becomes stale; every other handle stays valid.
+     *
+     * @param pos The handle of the element before the one to erase.
+     * @return The handle of the element following the erased one, or a null handle.
+     * @throws std::runtime_error if pos is null or stale, or if there is no element after it.
+     */
+    NodeHandle erase_after(NodeHandle pos) {
+        std::uint32_t before = checked_slot(pos);
+        std::uint32_t index = slots[before].next;
+        if (index == npos) {
+            throw std::runtime_error("No element after the position to erase.");
+        }
+        slots[before].next = slots[index].next;
+        if (index == tail) tail = before;
+        release(index);
+        --list_size;
+        return handle_of(slots[before].next);
+    }
+
+    /**
+     * @brief Removes the first element of the list.
+     * @throws std::runtime_error if the list is empty.
+     */
+    void pop_front() {
+        if (head == npos) {
+            throw std::runtime_error("List is empty: cannot pop front.");
+        }
+        std::uint32_t index = head;
+        head = slots[index].next;
+        if (head == npos) tail = npos;
+        release(index);
+        --list_size;
+    }
+
+    /**
+     * @brief Removes every element, making every handle stale while keeping the slot table.
+     */
+    void clear() {
+        while (head != npos) {
+            std::uint32_t index = head;
+            head = slots[index].next;
+            release(index);
+        }
+        tail = npos;
+        list_size = 0;
+    }
+
+    Iterator begin() { return Iterator(this, head); }
+    Iterator end() { return Iterator(this, npos); }
+    ConstIterator begin() const { return ConstIterator(this, head); }
+    ConstIterator end() const { return ConstIterator(this, npos); }
+};
+
+#endif // HANDLELIST_HPP
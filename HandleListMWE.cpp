@@ -0,0 +1,126 @@
+#include "HandleList.hpp"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+int main() {
+    std::cout << "HandleList MWE test starts!\n";
+
+    // Test pushes, handles and iteration
+    HandleList<int> list;
+    assert(list.empty() && list.front_handle().null() && !list.contains(NodeHandle{}));
+    NodeHandle two = list.push_back(2);
+    NodeHandle one = list.push_front(1);
+    NodeHandle four = list.push_back(4);
+    NodeHandle three = list.insert_after(two, 3);
+    assert(list.size() == 4 && list.front() == 1 && list.back() == 4);
+    assert(list[one] == 1 && list[two] == 2 && list[three] == 3 && list[four] == 4);
+    assert(list.front_handle() == one && list.back_handle() == four && list.next(two) == three && list.next(four).null());
+    std::vector<int> values(list.begin(), list.end());
+    assert((values == std::vector<int>{1, 2, 3, 4}));
+    list[three] = 30;
+    const HandleList<int>& view = list;
+    assert(view[three] == 30 && std::next(view.begin(), 2).handle() == three);
+    std::cout << "0\n";
+
+    // Test erase_after, staleness and slot reuse
+    assert(list.erase_after(two) == four);
+    assert(!list.contains(three) && list.contains(two) && list.size() == 3);
+    NodeHandle five = list.insert_after(two, 5);
+    assert(five.slot == three.slot && five.generation != three.generation);
+    assert(!list.contains(three) && list[five] == 5);
+    assert(list.erase_after(five).null() && list.back_handle() == five);
+    NodeHandle six = list.push_back(6);
+    assert(list.next(five) == six && list.back() == 6);
+    list.pop_front();
+    assert(!list.contains(one) && list.front_handle() == two);
+    bool thrown = false;
+    try {
+        list[three] = 0;
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        list.erase_after(six);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        list.insert_after(one, 0);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "1\n";
+
+    // Test random edits through handles against a std::list
+    std::mt19937 rng(5);
+    HandleList<std::string> words;
+    std::list<std::string> mirror;
+    std::vector<NodeHandle> handles;
+    std::vector<std::list<std::string>::iterator> positions;
+    std::vector<NodeHandle> erased;
+    for (int step = 0; step < 20000; ++step) {
+        std::string value = std::to_string(rng() % 1000);
+        std::size_t op = rng() % 4;
+        if (handles.empty() || op == 0) {
+            handles.push_back(words.push_back(value));
+            positions.push_back(mirror.insert(mirror.end(), value));
+        } else if (op == 1) {
+            std::size_t at = rng() % handles.size();
+            handles.push_back(words.insert_after(handles[at], value));
+            positions.push_back(mirror.insert(std::next(positions[at]), value));
+        } else {
+            std::size_t at = rng() % handles.size();
+            if (std::next(positions[at]) == mirror.end()) continue;
+            NodeHandle victim = words.next(handles[at]);
+            auto found = std::find(handles.begin(), handles.end(), victim);
+            assert(found != handles.end());
+            std::size_t index = static_cast<std::size_t>(found - handles.begin());
+            words.erase_after(handles[at]);
+            mirror.erase(positions[index]);
+            erased.push_back(victim);
+            handles.erase(handles.begin() + static_cast<std::ptrdiff_t>(index));
+            positions.erase(positions.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+        assert(words.size() == mirror.size());
+        if (step % 500 == 0) {
+            assert(std::equal(words.begin(), words.end(), mirror.begin(), mirror.end()));
+            for (std::size_t i = 0; i < handles.size(); ++i) assert(words[handles[i]] == *positions[i]);
+            for (NodeHandle stale : erased) assert(!words.contains(stale));
+        }
+    }
+    std::cout << "2\n";
+
+    // Test clear and reserve
+    std::size_t slotsBefore = words.capacity();
+    words.clear();
+    assert(words.empty() && words.begin() == words.end() && words.capacity() == slotsBefore);
+    for (NodeHandle handle : handles) assert(!words.contains(handle));
+    HandleList<int> reserved;
+    reserved.reserve(100);
+    NodeHandle first = reserved.push_back(0);
+    const int* address = &reserved[first];
+    for (int i = 1; i < 100; ++i) reserved.push_back(i);
+    assert(&reserved[first] == address && reserved.size() == 100);
+    thrown = false;
+    try {
+        HandleList<int>().pop_front();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "3\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,253 @@
+#ifndef HUGEPAGEARENA_HPP
+#define HUGEPAGEARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include <vector>
+#include <sys/mman.h>
+
+/**
+ * @brief Node arena backed by huge pages where the system provides them.
+ *
+ * Memory is reserved in large regions with mmap, first as explicit huge pages (MAP_HUGETLB),
+ * then as transparent huge pages (MADV_HUGEPAGE), and finally as normal pages when neither is
+ * available. Blocks are carved from the regions per 16-byte size class and recycled through
+ * free lists, so a long list's nodes are packed into a few huge pages and a traversal needs far
+ * fewer TLB entries. Regions are only returned to the system when the arena is destroyed.
+ */
+class HugePageArena {
+public:
+    static constexpr std::size_t granularity = 16; //!< Size class step in bytes.
+    static constexpr std::size_t max_small_size = 512; //!< Largest size served from the arena.
+    static constexpr std::size_t class_count = max_small_size / granularity;
+    static constexpr std::size_t huge_page_size = 2 * 1024 * 1024; //!< Region size granularity.
+
+    /**
+     * @brief How the arena's regions are backed.
+     */
+    enum class Backing {
+        HugeTlb, //!< Explicit huge pages from MAP_HUGETLB.
+        TransparentHuge, //!< Normal mapping advised with MADV_HUGEPAGE.
+        Normal //!< Normal pages only.
+    };
+
+    /**
+     * @brief Constructs an arena that maps memory in regions of the given size.
+     * @param regionBytes The size of every region; rounded up to a multiple of huge_page_size.
+     */
+    explicit HugePageArena(std::size_t regionBytes = 64 * 1024 * 1024)
+        : region_bytes((std::max(regionBytes, huge_page_size) + huge_page_size - 1) / huge_page_size * huge_page_size),
+          weakest(Backing::HugeTlb) {}
+
+    HugePageArena(const HugePageArena&) = delete;
+    HugePageArena& operator=(const HugePageArena&) = delete;
+
+    /**
+     * @brief Unmaps every region. Outstanding blocks must have been freed before.
+     */
+    ~HugePageArena() {
+        for (const Region& region : regions) munmap(region.memory, region.bytes);
+    }
+
+    /**
+     * @brief Checks whether an allocation is served from the arena.
+     * @param bytes The size of the allocation.
+     * @param align The alignment of the allocation.
+     * @return True if the allocation is carved from a region.
+     */
+    static bool is_small(std::size_t bytes, std::size_t align) {
+        return bytes <= max_small_size && align <= granularity;
+    }
+
+    /**
+     * @brief Gets the weakest backing among the regions mapped so far.
+     * @return The backing; HugeTlb before the first region is mapped.
+     */
+    Backing backing() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return weakest;
+    }
+
+    /**
+     * @brief Gets the number of bytes mapped.
+     * @return The total size of all regions.
+     */
+    std::size_t mapped_bytes() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return regions.size() * region_bytes;
+    }
+
+    /**
+     * @brief Maps regions until at least the given number of bytes are mapped.
+     * @param bytes The number of bytes to have mapped.
+     */
+    void reserve(std::size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex);
+        while (regions.size() * region_bytes < bytes) map_region();
+    }
+
+    /**
+     * @brief Hands out a block from the free list of its size class, or carves a new one.
+     * @param bytes The size of the block; must satisfy is_small().
+     * @return Pointer to the block.
+     */
+    void* allocate(std::size_t bytes) {
+        std::size_t c = size_class(bytes);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (FreeBlock* block = free_lists[c]) {
+            free_lists[c] = block->next;
+            return block;
+        }
+        std::size_t size = (c + 1) * granularity;
+        if (cursor == nullptr || cursor + size > cursor_end) {
+            std::size_t next = next_region;
+            if (next >= regions.size()) map_region();
+            cursor = static_cast<std::byte*>(regions[next].memory);
+            cursor_end = cursor + region_bytes;
+            next_region = next + 1;
+        }
+        void* block = cursor;
+        cursor += size;
+        return block;
+    }
+
+    /**
+     * @brief Returns a block to the free list of its size class.
+     * @param p Pointer previously returned by allocate().
+     * @param bytes The size passed to allocate().
+     */
+    void deallocate(void* p, std::size_t bytes) noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        FreeBlock* block = static_cast<FreeBlock*>(p);
+        std::size_t c = size_class(bytes);
+        block->next = free_lists[c];
+        free_lists[c] = block;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next; //!< Next block in a free list.
+    };
+
+    struct Region {
+        void* memory; //!< Start of the mapping.
+        std::size_t bytes; //!< Length of the mapping.
+    };
+
+    std::size_t region_bytes; //!< Size of every region.
+    std::mutex mutex; //!< Guards every member below.
+    std::vector<Region> regions; //!< Mapped regions, in mapping order.
+    std::size_t next_region = 0; //!< Index of the next region to carve from.
+    std::byte* cursor = nullptr; //!< Next uncarved byte in the current region.
+    std::byte* cursor_end = nullptr; //!< End of the current region.
+    FreeBlock* free_lists[class_count] = {}; //!< Freed blocks per size class.
+    Backing weakest; //!< Weakest backing among the regions.
+
+    static std::size_t size_class(std::size_t bytes) {
+        return bytes == 0 ? 0 : (bytes - 1) / granularity;
+    }
+
+    /**
+     * @brief Maps one region with the strongest backing available.
+     */
+    void map_region() {
+        Backing kind = Backing::HugeTlb;
+        void* memory = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        memory = mmap(nullptr, region_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+        if (memory == MAP_FAILED) {
+            memory = mmap(nullptr, region_bytes + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memory == MAP_FAILED) throw std::bad_alloc();
+            auto start = reinterpret_cast<std::uintptr_t>(memory);
+            auto aligned = (start + huge_page_size - 1) & ~(huge_page_size - 1);
+            if (aligned > start) munmap(memory, aligned - start);
+            std::uintptr_t end = start + region_bytes + huge_page_size;
+            if (aligned + region_bytes < end) munmap(reinterpret_cast<void*>(aligned + region_bytes), end - aligned - region_bytes);
+            memory = reinterpret_cast<void*>(aligned);
+            kind = Backing::Normal;
+#ifdef MADV_HUGEPAGE
+            if (madvise(memory, region_bytes, MADV_HUGEPAGE) == 0) kind = Backing::TransparentHuge;
+#endif
+        }
+        regions.push_back(Region{memory, region_bytes});
+        if (kind > weakest) weakest = kind;
+    }
+};
+
+/**
+ * @brief Allocator that carves small objects from a HugePageArena.
+ *
+ * Meant for std::allocate_shared, which rebinds it to its internal control block type. Larger or
+ * over-aligned allocations fall through to the global allocator. Every copy keeps the arena alive.
+ *
+ * @tparam U Type of objects allocated.
+ */
+template<typename U>
+class HugePageAllocator {
+public:
+    using value_type = U;
+
+    template<typename V> friend class HugePageAllocator;
+
+    /**
+     * @brief Constructs an allocator drawing from the given arena.
+     * @param hugePageArena The arena to allocate from.
+     */
+    explicit HugePageAllocator(std::shared_ptr<HugePageArena> hugePageArena) noexcept : arena(std::move(hugePageArena)) {}
+
+    /**
+     * @brief Converting constructor used when rebinding.
+     * @param other The allocator to copy the arena from.
+     */
+    template<typename V>
+    HugePageAllocator(const HugePageAllocator<V>& other) noexcept : arena(other.arena) {}
+
+    /**
+     * @brief Gets the arena blocks are carved from.
+     * @return The arena.
+     */
+    const std::shared_ptr<HugePageArena>& get_arena() const noexcept { return arena; }
+
+    /**
+     * @brief Allocates storage for n objects.
+     * @param n The number of objects.
+     * @return Pointer to the storage.
+     */
+    U* allocate(std::size_t n) {
+        if (uses_arena(n)) return static_cast<U*>(arena->allocate(n * sizeof(U)));
+        return static_cast<U*>(::operator new(n * sizeof(U), std::align_val_t(alignof(U))));
+    }
+
+    /**
+     * @brief Frees storage previously returned by allocate().
+     * @param p Pointer to the storage.
+     * @param n The number of objects passed to allocate().
+     */
+    void deallocate(U* p, std::size_t n) noexcept {
+        if (uses_arena(n)) {
+            arena->deallocate(p, n * sizeof(U));
+        } else {
+            ::operator delete(p, std::align_val_t(alignof(U)));
+        }
+    }
+
+    template<typename V>
+    bool operator==(const HugePageAllocator<V>& other) const noexcept { return arena == other.arena; }
+
+    template<typename V>
+    bool operator!=(const HugePageAllocator<V>& other) const noexcept { return arena != other.arena; }
+
+private:
+    static bool uses_arena(std::size_t n) noexcept {
+        return n <= HugePageArena::max_small_size / sizeof(U) && HugePageArena::is_small(n * sizeof(U), alignof(U));
+    }
+
+    std::shared_ptr<HugePageArena> arena; //!< The arena blocks are carved from.
+};
+
+#endif // HUGEPAGEARENA_HPP
@@ -0,0 +1,63 @@
+#include "HugePageArena.hpp"
+#include "SinglyLinkedList.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+
+int main() {
+    std::cout << "HugePageArena MWE test starts!\n";
+
+    // Test blocks are carved, recycled per size class and fall back to normal pages if needed
+    auto arena = std::make_shared<HugePageArena>(1);
+    void* a = arena->allocate(40);
+    arena->deallocate(a, 40);
+    void* b = arena->allocate(48);
+    assert(a == b);
+    arena->deallocate(b, 48);
+    assert(arena->mapped_bytes() == HugePageArena::huge_page_size);
+    HugePageArena::Backing backing = arena->backing();
+    assert(backing == HugePageArena::Backing::HugeTlb || backing == HugePageArena::Backing::TransparentHuge
+           || backing == HugePageArena::Backing::Normal);
+    std::cout << "0\n";
+
+    // Test a list whose nodes span several regions
+    using List = SinglyLinkedList<long, HugePageAllocator<long>>;
+    {
+        List list{HugePageAllocator<long>(arena)};
+        for (long i = 0; i < 100000; ++i) list.push_back(i);
+        assert(list.size() == 100000 && list.back() == 99999);
+        assert(arena->mapped_bytes() > HugePageArena::huge_page_size);
+        long sum = 0;
+        for (long x : list) sum += x;
+        assert(sum == 99999L * 100000 / 2);
+    }
+    std::size_t mapped = arena->mapped_bytes();
+    List reused{HugePageAllocator<long>(arena)};
+    for (long i = 0; i < 100000; ++i) reused.push_back(i);
+    assert(arena->mapped_bytes() == mapped);
+    std::cout << "1\n";
+
+    // Test reserve and large values that bypass the arena
+    arena->reserve(mapped + 1);
+    assert(arena->mapped_bytes() > mapped);
+    SinglyLinkedList<std::string, HugePageAllocator<std::string>> strings{HugePageAllocator<std::string>(arena)};
+    strings.push_back(std::string(1000, 'q'));
+    assert(strings.front().size() == 1000);
+    std::cout << "2\n";
+
+    // Test the arena lives as long as its last node
+    std::weak_ptr<HugePageArena> watched;
+    {
+        List survivor{HugePageAllocator<long>(std::make_shared<HugePageArena>())};
+        watched = survivor.get_allocator().get_arena();
+        survivor.push_back(7);
+        List alias = survivor;
+        survivor = List{HugePageAllocator<long>(std::make_shared<HugePageArena>())};
+        assert(!watched.expired() && alias.front() == 7);
+    }
+    assert(watched.expired());
+    std::cout << "3\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
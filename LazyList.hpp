@@ -0,0 +1,334 @@
+#ifndef LAZYLIST_HPP
+#define LAZYLIST_HPP
+
+#include <stdexcept>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief A lazily materialized singly linked stream.
+ *
+ * Each node is produced by a thunk the first time iteration reaches it and is memoized afterwards,
+ * so copies of a LazyList share the nodes computed so far. take, drop, map and filter build new
+ * lazy lists without computing anything. A LazyList is not thread-safe, and copies that share
+ * nodes must not be iterated from different threads.
+ *
+ * @tparam T Type of elements stored in the list.
+ */
+template<typename T>
+class LazyList {
+private:
+    template<typename U> friend class LazyList;
+
+    struct Cell;
+    using CellPtr = std::shared_ptr<Cell>;
+    using Step = std::optional<std::pair<T, CellPtr>>;
+
+    /**
+     * @brief A possibly unevaluated node of the stream.
+     */
+    struct Cell {
+        std::function<Step()> thunk; //!< Computes the node; empty once forced.
+        std::optional<T> data; //!< The element, or empty at the end of the stream.
+        CellPtr next; //!< The rest of the stream, once forced.
+
+        explicit Cell(std::function<Step()> compute) : thunk(std::move(compute)) {}
+
+        /**
+         * @brief Destructor for Cell, unlinking memoized successors iteratively.
+         */
+        ~Cell() {
+            CellPtr rest = std::move(next);
+            while (rest && rest.use_count() == 1) {
+                CellPtr after = std::move(rest->next);
+                rest = std::move(after);
+            }
+        }
+
+        /**
+         * @brief Evaluates the node if it has not been evaluated yet.
+         *
+         * If the computation throws, the node stays unevaluated and the next force() retries it.
+         *
+         * @return True if the node holds an element, false at the end of the stream.
+         */
+        bool force() {
+            if (thunk) {
+                std::function<Step()> compute = std::move(thunk);
+                thunk = nullptr;
+                Step step;
+                try {
+                    step = compute();
+                } catch (...) {
+                    thunk = std::move(compute);
+                    throw;
+                }
+                if (step) {
+                    data.emplace(std::move(step->first));
+                    next = std::move(step->second);
+                }
+            }
+            return data.has_value();
+        }
+    };
+
+    CellPtr cell; //!< The first node, or null for an empty list.
+
+    explicit LazyList(CellPtr first) : cell(std::move(first)) {}
+
+    static CellPtr make_cell(std::function<Step()> compute) {
+        return std::make_shared<Cell>(std::move(compute));
+    }
+
+    static bool at_end(const CellPtr& c) {
+        return !c || !c->force();
+    }
+
+    template<typename Gen>
+    static CellPtr generator_cell(std::shared_ptr<Gen> gen) {
+        return make_cell([gen]() -> Step {
+            std::optional<T> value = (*gen)();
+            if (!value) return std::nullopt;
+            return Step(std::in_place, std::move(*value), generator_cell(gen));
+        });
+    }
+
+    template<typename InputIt>
+    static CellPtr range_cell(InputIt first, InputIt last) {
+        return make_cell([first, last]() mutable -> Step {
+            if (first == last) return std::nullopt;
+            T value = *first;
+            ++first;
+            return Step(std::in_place, std::move(value), range_cell(first, last));
+        });
+    }
+
+    static CellPtr take_cell(CellPtr src, std::size_t n) {
+        return make_cell([src, n]() -> Step {
+            if (n == 0 || at_end(src)) return std::nullopt;
+            return Step(std::in_place, *src->data, take_cell(src->next, n - 1));
+        });
+    }
+
+    template<typename Pred>
+    static CellPtr filter_cell(CellPtr src, std::shared_ptr<Pred> pred) {
+        return make_cell([src, pred]() mutable -> Step {
+            while (!at_end(src)) {
+                if ((*pred)(*src->data)) {
+                    return Step(std::in_place, *src->data, filter_cell(src->next, pred));
+                }
+                src = src->next;
+            }
+            return std::nullopt;
+        });
+    }
+
+public:
+    using value_type = T;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+
+    /**
+     * @brief Default constructor for an empty LazyList.
+     */
+    LazyList() : cell(nullptr) {}
+
+    /**
+     * @brief Creates a lazy list from a generator.
+     * @param gen Callable returning std::optional<T>; each call yields the next element, std::nullopt ends the list.
+     * @return A LazyList that calls gen only as iteration reaches new elements.
+     */
+    template<typename Gen>
+    static LazyList generate(Gen gen) {
+        return LazyList(generator_cell(std::make_shared<Gen>(std::move(gen))));
+    }
+
+    /**
+     * @brief Creates a lazy list from a range of iterators.
+     * @param first The start iterator of the range.
+     * @param last The end iterator of the range.
+     * @return A LazyList that reads the range only as iteration reaches new elements.
+     */
+    template<typename InputIt>
+    static LazyList from_range(InputIt first, InputIt last) {
+        return LazyList(range_cell(first, last));
+    }
+
+    /**
+     * @brief Check if the LazyList is empty, materializing its first element.
+     * @return True if the LazyList is empty, false if not.
+     */
+    bool empty() const {
+        return at_end(cell);
+    }
+
+    /**
+     * @brief Retrieves the first element, materializing it if necessary.
+     * @return A const reference to the first element.
+     * @throws std::runtime_error if the list is empty.
+     */
+    const T& front() const {
+        if (at_end(cell)) {
+            throw std::runtime_error("List is empty: cannot access head.");
+        }
+        return *cell->data;
+    }
+
+    /**
+     * @brief Lazily keeps the first n elements.
+     * @param n The maximum number of elements to keep.
+     * @return A LazyList of at most n elements.
+     */
+    LazyList take(std::size_t n) const {
+        return cell ? LazyList(take_cell(cell, n)) : LazyList();
+    }
+
+    /**
+     * @brief Lazily skips the first n elements.
+     * @param n The number of elements to skip.
+     * @return A LazyList without the first n elements.
+     */
+    LazyList drop(std::size_t n) const {
+        if (!cell) return LazyList();
+        CellPtr src = cell;
+        return LazyList(make_cell([src, n]() mutable -> Step {
+            for (std::size_t i = 0; i < n && !at_end(src); ++i) {
+                src = src->next;
+            }
+            if (at_end(src)) return std::nullopt;
+            return Step(std::in_place, *src->data, src->next);
+        }));
+    }
+
+    /**
+     * @brief Lazily applies a function to every element.
+     * @param fn Callable applied to each element when it is materialized.
+     * @return A LazyList of the results.
+     */
+    template<typename Fn>
+    auto map(Fn fn) const -> LazyList<std::decay_t<std::invoke_result_t<Fn&, const T&>>> {
+        using R = std::decay_t<std::invoke_result_t<Fn&, const T&>>;
+        if (!cell) return LazyList<R>();
+        return LazyList<R>(LazyList<R>::template map_cell<T>(cell, std::make_shared<Fn>(std::move(fn))));
+    }
+
+    /**
+     * @brief Lazily keeps the elements satisfying a predicate.
+     * @param pred Predicate applied to each element when it is reached.
+     * @return A LazyList of the matching elements.
+     */
+    template<typename Pred>
+    LazyList filter(Pred pred) const {
+        return cell ? LazyList(filter_cell(cell, std::make_shared<Pred>(std::move(pred)))) : LazyList();
+    }
+
+    /**
+     * @brief Materializes the whole list into a std::vector.
+     * @return A std::vector containing the list elements.
+     */
+    std::vector<T> to_vector() const {
+        return std::vector<T>(begin(), end());
+    }
+
+    /**
+     * @brief Forward iterator that materializes nodes as it advances.
+     */
+    class ConstIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        /**
+         * @brief Constructs an end iterator.
+         */
+        ConstIterator() : current(nullptr) {}
+
+        /**
+         * @brief Constructs an iterator starting at the given node.
+         * @param start The starting node.
+         */
+        explicit ConstIterator(CellPtr start) : current(std::move(start)) {
+            if (at_end(current)) current.reset();
+        }
+
+        /**
+         * @brief Dereferences the iterator to access the current element.
+         * @return Const reference to the current element.
+         */
+        const T& operator*() const { return *current->data; }
+
+        /**
+         * @brief Accesses the current element through the iterator.
+         * @return Const pointer to the current element.
+         */
+        const T* operator->() const { return &*current->data; }
+
+        /**
+         * @brief Advances the iterator, materializing the next element.
+         * @return Reference to this iterator.
+         */
+        ConstIterator& operator++() {
+            CellPtr next = current->next;
+            current = at_end(next) ? nullptr : std::move(next);
+            return *this;
+        }
+
+        /**
+         * @brief Advances the iterator to the next element (postfix).
+         * @return The previous state of the iterator.
+         */
+        ConstIterator operator++(int) {
+            ConstIterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        /**
+         * @brief Checks if two iterators are equal.
+         * @param other The other iterator to compare with.
+         * @return True if the iterators are equal, false otherwise.
+         */
+        bool operator==(const ConstIterator& other) const { return current == other.current; }
+
+        /**
+         * @brief Checks if two iterators are not equal.
+         * @param other The other iterator to compare with.
+         * @return True if the iterators are not equal, false otherwise.
+         */
+        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+
+    private:
+        CellPtr current; //!< Current node, or null at the end.
+    };
+
+    /**
+     * @brief Gets a const iterator to the beginning of the list, materializing the first element.
+     * @return A ConstIterator pointing to the first element.
+     */
+    ConstIterator begin() const { return ConstIterator(cell); }
+
+    /**
+     * @brief Gets a const iterator to the end of the list.
+     * @return A ConstIterator pointing to one past the last element.
+     */
+    ConstIterator end() const { return ConstIterator(); }
+
+private:
+    template<typename Src, typename Fn>
+    static CellPtr map_cell(typename LazyList<Src>::CellPtr src, std::shared_ptr<Fn> fn) {
+        return make_cell([src, fn]() -> Step {
+            if (LazyList<Src>::at_end(src)) return std::nullopt;
+            return Step(std::in_place, (*fn)(*src->data), map_cell<Src>(src->next, fn));
+        });
+    }
+};
+
+#endif // LAZYLIST_HPP
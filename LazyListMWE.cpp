@@ -0,0 +1,93 @@
+#include "LazyList.hpp"
+#include "SinglyLinkedList.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+
+int main() {
+    std::cout << "LazyList MWE test starts!\n";
+
+    // Test that nothing is materialized until iteration
+    int calls = 0;
+    auto naturals = LazyList<int>::generate([&calls, n = 0]() mutable -> std::optional<int> {
+        ++calls;
+        return n++;
+    });
+    auto pipeline = naturals.filter([](int x) { return x % 3 == 0; }).map([](int x) { return std::to_string(x); }).drop(2).take(4);
+    assert(calls == 0);
+    std::cout << "0\n";
+
+    // Test composed results and how much of the source is read
+    std::vector<std::string> result = pipeline.to_vector();
+    assert((result == std::vector<std::string>{"6", "9", "12", "15"}));
+    assert(calls == 16);
+    std::cout << "1\n";
+
+    // Test memoization shared between copies
+    auto again = pipeline;
+    assert(again.to_vector() == result);
+    assert(naturals.take(10).to_vector().back() == 9);
+    assert(calls == 16);
+    std::cout << "2\n";
+
+    // Test finite generators and ranges
+    std::vector<int> source = {5, 4, 3, 2, 1};
+    auto fromRange = LazyList<int>::from_range(source.begin(), source.end());
+    assert(fromRange.front() == 5);
+    assert(fromRange.drop(3).to_vector() == std::vector<int>({2, 1}));
+    assert(fromRange.drop(10).empty());
+    assert(fromRange.take(0).empty());
+    auto countdown = LazyList<int>::generate([n = 3]() mutable -> std::optional<int> {
+        if (n == 0) return std::nullopt;
+        return n--;
+    });
+    assert(countdown.to_vector() == std::vector<int>({3, 2, 1}));
+    std::cout << "3\n";
+
+    // Test materializing into a SinglyLinkedList
+    auto evens = naturals.filter([](int x) { return x % 2 == 0; }).take(5);
+    SinglyLinkedList<int> list(evens.begin(), evens.end());
+    assert(list.size() == 5 && list.back() == 8);
+    std::cout << "4\n";
+
+    // Test empty lists and long chains
+    LazyList<int> empty;
+    assert(empty.empty());
+    bool thrown = false;
+    try {
+        empty.front();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    auto longList = naturals.take(1000000);
+    long long total = 0;
+    for (int x : longList) total += x;
+    assert(total == 499999500000LL);
+    std::cout << "5\n";
+
+    // Test that a throwing computation is retried rather than ending the stream
+    bool failOnce = true;
+    auto flaky = fromRange.map([&failOnce](int x) {
+        if (x == 3 && failOnce) {
+            failOnce = false;
+            throw std::runtime_error("transient");
+        }
+        return x * 10;
+    });
+    auto flakyCopy = flaky;
+    thrown = false;
+    try {
+        flaky.to_vector();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert((flakyCopy.to_vector() == std::vector<int>{50, 40, 30, 20, 10}));
+    assert(flaky.drop(2).front() == 30);
+    std::cout << "6\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,263 @@
+#ifndef MONOTONICQUEUE_HPP
+#define MONOTONICQUEUE_HPP
+
+#include <stdexcept>
+#include <cstddef>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <utility>
+#include "SinglyLinkedList.hpp"
+
+/**
+ * @brief A sliding window that answers min() and max() in O(1), with count and time expiry.
+ *
+ * The window's elements live in a SinglyLinkedList, pushed at the back and expired from the
+ * front. Two monotonic deques hold pointers to the elements that can still become the minimum
+ * or the maximum: a new element evicts every older candidate it beats, since that candidate
+ * would leave the window first. Each element enters and leaves each deque at most once, so
+ * push(), pop(), min() and max() are amortized O(1) and the window is never rescanned. Nodes
+ * of a SinglyLinkedList never move, which keeps the pointers valid until their element expires.
+ *
+ * @tparam T Type of elements stored in the window.
+ * @tparam Compare Strict weak ordering; min() is the first element by it and max() the last.
+ * @tparam Clock Clock providing the timestamps for time-based expiry.
+ */
+template<typename T, typename Compare = std::less<T>, typename Clock = std::chrono::steady_clock>
+class MonotonicQueue {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+private:
+    /**
+     * @brief An element with the time it was pushed.
+     */
+    struct Entry {
+        T value; //!< The element.
+        time_point time; //!< When the element was pushed.
+    };
+
+    SinglyLinkedList<Entry> entries; //!< The window, oldest first.
+    std::deque<const Entry*> min_candidates; //!< Increasing by comp, oldest first.
+    std::deque<const Entry*> max_candidates; //!< Decreasing by comp, oldest first.
+    std::size_t max_count; //!< Number of elements kept by push().
+    duration window; //!< How long an element stays; duration::max() for no time expiry.
+    [[no_unique_address]] Compare comp; //!< The ordering.
+
+    /**
+     * @brief Appends an entry and makes it a candidate, evicting the candidates it beats.
+     *
+     * The comparisons run before anything is changed, and a failed append is rolled back, so
+     * the window is left unchanged if comp or an allocation throws.
+     *
+     * @param entry The entry to append.
+     */
+    void admit(Entry entry) {
+        std::size_t beatenMin = 0;
+        for (auto it = min_candidates.rbegin(); it != min_candidates.rend() && !comp((*it)->value, entry.value); ++it) ++beatenMin;
+        std::size_t beatenMax = 0;
+        for (auto it = max_candidates.rbegin(); it != max_candidates.rend() && !comp(entry.value, (*it)->value); ++it) ++beatenMax;
+        entries.push_back(std::move(entry));
+        const Entry* added = &entries.back();
+        try {
+            min_candidates.push_back(added);
+            try {
+                max_candidates.push_back(added);
+            } catch (...) {
+                min_candidates.pop_back();
+                throw;
+            }
+        } catch (...) {
+            entries.pop_back();
+            throw;
+        }
+        retire(min_candidates, beatenMin);
+        retire(max_candidates, beatenMax);
+    }
+
+    /**
+     * @brief Drops the candidates just before the last one, without throwing.
+     * @param candidates The candidate deque.
+     * @param beaten The number of candidates to drop.
+     */
+    static void retire(std::deque<const Entry*>& candidates, std::size_t beaten) {
+        if (beaten == 0) return;
+        candidates[candidates.size() - 1 - beaten] = candidates.back();
+        for (; beaten != 0; --beaten) candidates.pop_back();
+    }
+
+public:
+    /**
+     * @brief Constructs a window that keeps the last elements pushed.
+     * @param maxCount The number of elements to keep; push() expires the oldest beyond it.
+     * @param compare The ordering.
+     */
+    explicit MonotonicQueue(std::size_t maxCount = std::numeric_limits<std::size_t>::max(), Compare compare = Compare())
+        : max_count(maxCount), window(duration::max()), comp(std::move(compare)) {}
+
+    /**
+     * @brief Constructs a window that keeps the elements pushed within a duration.
+     * @param span How long an element stays in the window.
+     * @param maxCount The number of elements to keep at most.
+     * @param compare The ordering.
+     */
+    explicit MonotonicQueue(duration span, std::size_t maxCount = std::numeric_limits<std::size_t>::max(), Compare compare = Compare())
+        : max_count(maxCount), window(span), comp(std::move(compare)) {}
+
+    /**
+     * @brief Copy constructor for MonotonicQueue.
+     *
+     * The candidates point into the copied list, so they are rebuilt by replaying its elements.
+     *
+     * @param other The window to copy.
+     */
+    MonotonicQueue(const MonotonicQueue& other) : max_count(other.max_count), window(other.window), comp(other.comp) {
+        for (const Entry& entry : other.entries) admit(entry);
+    }
+
+    /**
+     * @brief Move constructor for MonotonicQueue; the nodes, and so the candidates, stay valid.
+     * @param other The window to move from.
+     */
+    MonotonicQueue(MonotonicQueue&& other) = default;
+
+    /**
+     * @brief Copy assignment operator for MonotonicQueue.
+     * @param other The window to copy.
+     * @return Reference to this MonotonicQueue.
+     */
+    MonotonicQueue& operator=(const MonotonicQueue& other) {
+        if (this != &other) *this = MonotonicQueue(other);
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator for MonotonicQueue.
+     * @param other The window to move from.
+     * @return Reference to this MonotonicQueue.
+     */
+    MonotonicQueue& operator=(MonotonicQueue&& other) = default;
+
+    /**
+     * @brief Checks if the window is empty.
+     * @return True if the window is empty, false otherwise.
+     */
+    bool empty() const { return entries.empty(); }
+
+    /**
+     * @brief Gets the size of the window.
+     * @return The number of elements in the window.
+     */
+    std::size_t size() const { return entries.size(); }
+
+    /**
+     * @brief Adds an element, expiring the elements older than the window and beyond the count.
+     * @param value The value to add.
+     * @param now The time of the push; must not be earlier than any previous push.
+     */
+    void push(const T& value, time_point now) {
+        expire(now);
+        admit(Entry{value, now});
+        if (entries.size() > max_count) pop();
+    }
+
+    /**
+     * @brief Adds an element at the current time of the clock.
+     * @param value The value to add.
+     */
+    void push(const T& value) {
+        push(value, window == duration::max() ? time_point() : Clock::now());
+    }
+
+    /**
+     * @brief Removes the oldest element.
+     * @throws std::runtime_error if the window is empty.
+     */
+    void pop() {
+        if (entries.empty()) {
+            throw std::runtime_error("List is empty: cannot pop front.");
+        }
+        const Entry* oldest = &entries.front();
+        if (min_candidates.front() == oldest) min_candidates.pop_front();
+        if (max_candidates.front() == oldest) max_candidates.pop_front();
+        entries.pop_front();
+    }
+
+    /**
+     * @brief Removes every element pushed at or before now minus the window's duration.
+     * @param now The current time.
+     * @return The number of elements removed.
+     */
+    std::size_t expire(time_point now) {
+        if (window == duration::max()) return 0;
+        std::size_t removed = 0;
+        while (!entries.empty() && now - entries.front().time >= window) {
+            pop();
+            ++removed;
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Retrieves the smallest element of the window.
+     * @return A reference to the first element by comp; the newest one among equals.
+     * @throws std::runtime_error if the window is empty.
+     */
+    const T& min() const {
+        if (entries.empty()) {
+            throw std::runtime_error("List is empty: cannot access min.");
+        }
+        return min_candidates.front()->value;
+    }
+
+    /**
+     * @brief Retrieves the largest element of the window.
+     * @return A reference to the last element by comp; the newest one among equals.
+     * @throws std::runtime_error if the window is empty.
+     */
+    const T& max() const {
+        if (entries.empty()) {
+            throw std::runtime_error("List is empty: cannot access max.");
+        }
+        return max_candidates.front()->value;
+    }
+
+    /**
+     * @brief Retrieves the oldest element.
+     * @return A reference to the element.
+     * @throws std::runtime_error if the window is empty.
+     */
+    const T& front() const {
+        if (entries.empty()) {
+            throw std::runtime_error("List is empty: cannot access head.");
+        }
+        return entries.front().value;
+    }
+
+    /**
+     * @brief Retrieves the newest element.
+     * @return A reference to the element.
+     * @throws std::runtime_error if the window is empty.
+     */
+    const T& back() const {
+        if (entries.empty()) {
+            throw std::runtime_error("List is empty: cannot access tail.");
+        }
+        return entries.back().value;
+    }
+
+    /**
+     * @brief Removes every element.
+     */
+    void clear() {
+        min_candidates.clear();
+        max_candidates.clear();
+        entries.clear();
+    }
+};
+
+#endif // MONOTONICQUEUE_HPP
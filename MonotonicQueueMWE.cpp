@@ -0,0 +1,137 @@
+#include "MonotonicQueue.hpp"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <deque>
+#include <memory>
+
+int main() {
+    std::cout << "MonotonicQueue MWE test starts!\n";
+
+    // Test min and max of a small window
+    MonotonicQueue<int> window;
+    assert(window.empty());
+    window.push(5);
+    window.push(2);
+    window.push(8);
+    window.push(3);
+    assert(window.size() == 4 && window.min() == 2 && window.max() == 8);
+    assert(window.front() == 5 && window.back() == 3);
+    window.pop();
+    window.pop();
+    assert(window.min() == 3 && window.max() == 8);
+    window.pop();
+    assert(window.min() == 3 && window.max() == 3);
+    window.pop();
+    assert(window.empty());
+    std::cout << "0\n";
+
+    // Test count-based expiry against rescanning
+    std::mt19937 rng(11);
+    MonotonicQueue<int> counted(50);
+    std::deque<int> mirror;
+    for (int step = 0; step < 20000; ++step) {
+        int value = static_cast<int>(rng() % 100);
+        counted.push(value);
+        mirror.push_back(value);
+        if (mirror.size() > 50) mirror.pop_front();
+        if (step % 13 == 0) {
+            counted.pop();
+            mirror.pop_front();
+        }
+        assert(counted.size() == mirror.size());
+        if (mirror.empty()) continue;
+        assert(counted.min() == *std::min_element(mirror.begin(), mirror.end()));
+        assert(counted.max() == *std::max_element(mirror.begin(), mirror.end()));
+        assert(counted.front() == mirror.front());
+    }
+    std::cout << "1\n";
+
+    // Test time-based expiry with explicit timestamps
+    using Clock = std::chrono::steady_clock;
+    MonotonicQueue<double> timed(std::chrono::seconds(10));
+    Clock::time_point start{};
+    timed.push(4.0, start);
+    timed.push(9.0, start + std::chrono::seconds(3));
+    timed.push(1.0, start + std::chrono::seconds(6));
+    assert(timed.min() == 1.0 && timed.max() == 9.0);
+    timed.push(5.0, start + std::chrono::seconds(10));
+    assert(timed.size() == 3 && timed.front() == 9.0);
+    assert(timed.expire(start + std::chrono::seconds(13)) == 1);
+    assert(timed.min() == 1.0 && timed.max() == 5.0);
+    assert(timed.expire(start + std::chrono::seconds(30)) == 2);
+    assert(timed.empty());
+    MonotonicQueue<int> both(std::chrono::hours(1), 2);
+    both.push(1, start);
+    both.push(2, start);
+    both.push(3, start);
+    assert(both.size() == 2 && both.min() == 2 && both.max() == 3);
+    std::cout << "2\n";
+
+    // Test a custom ordering and errors on an empty window
+    MonotonicQueue<std::string, std::greater<>> reversed;
+    reversed.push("pear");
+    reversed.push("apple");
+    reversed.push("zucchini");
+    assert(reversed.min() == "zucchini" && reversed.max() == "apple");
+    reversed.clear();
+    bool thrown = false;
+    try {
+        reversed.min();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        reversed.pop();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "3\n";
+
+    // Test copies, moves and a throwing comparison
+    auto source = std::make_unique<MonotonicQueue<int>>(4);
+    for (int value : {7, 3, 9, 5}) source->push(value);
+    MonotonicQueue<int> copied(*source);
+    MonotonicQueue<int> assigned;
+    assigned = *source;
+    source.reset();
+    copied.push(6);
+    assert(copied.size() == 4 && copied.min() == 3 && copied.max() == 9 && copied.front() == 3);
+    copied.pop();
+    copied.pop();
+    assert(copied.min() == 5 && copied.max() == 6);
+    assigned.pop();
+    assert(assigned.min() == 3 && assigned.max() == 9);
+    MonotonicQueue<int> moved(std::move(assigned));
+    moved.pop();
+    moved.pop();
+    assert(moved.size() == 1 && moved.min() == 5 && moved.max() == 5);
+    struct ThrowingLess {
+        bool operator()(int a, int b) const {
+            if (a == 13 || b == 13) throw std::runtime_error("unlucky");
+            return a < b;
+        }
+    };
+    MonotonicQueue<int, ThrowingLess> guarded;
+    guarded.push(2);
+    guarded.push(1);
+    thrown = false;
+    try {
+        guarded.push(13);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && guarded.size() == 2 && guarded.back() == 1);
+    assert(guarded.min() == 1 && guarded.max() == 2);
+    guarded.pop();
+    assert(guarded.min() == 1 && guarded.max() == 1);
+    std::cout << "4\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,272 @@
+#ifndef NODEPOOL_HPP
+#define NODEPOOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+/**
+ * @brief A free list of fixed-size blocks carved from bulk-allocated slabs.
+ *
+ * reserve(n) allocates room for n blocks in a single allocation, so a burst of up to n node
+ * allocations afterwards never reaches the global allocator. Freed blocks go back onto the free
+ * list. Blocks may be freed from another thread than the one allocating (for example by the
+ * AsyncReclaimer), so the free list is guarded by a spin lock.
+ */
+class NodePool {
+private:
+    struct FreeBlock {
+        FreeBlock* next; //!< Next free block.
+    };
+
+    struct Slab {
+        std::byte* memory; //!< Start of the slab.
+        std::size_t blocks; //!< Number of blocks in the slab.
+    };
+
+    /**
+     * @brief Scoped spin lock over the pool's lock flag.
+     */
+    class Guard {
+    public:
+        explicit Guard(std::atomic<bool>& flag) : locked(flag) {
+            while (locked.exchange(true, std::memory_order_acquire)) {
+                while (locked.load(std::memory_order_relaxed)) {}
+            }
+        }
+        ~Guard() { locked.store(false, std::memory_order_release); }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        std::atomic<bool>& locked;
+    };
+
+    std::size_t block_bytes; //!< Size of every block.
+    FreeBlock* free_list; //!< Blocks ready to be handed out.
+    std::size_t free_blocks; //!< Number of blocks on the free list.
+    std::vector<Slab> slabs; //!< Slabs owned by the pool, sorted by address.
+    std::atomic<bool> lock; //!< Guards every member above.
+
+    static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+    bool in_slab(const void* p, const Slab& slab) const {
+        auto address = reinterpret_cast<std::uintptr_t>(p);
+        auto start = reinterpret_cast<std::uintptr_t>(slab.memory);
+        return address >= start && address < start + slab.blocks * block_bytes;
+    }
+
+    const Slab* find_slab(const void* p) const {
+        auto it = std::upper_bound(slabs.begin(), slabs.end(), p, [](const void* q, const Slab& slab) {
+            return std::less<const void*>()(q, slab.memory);
+        });
+        if (it == slabs.begin()) return nullptr;
+        --it;
+        return in_slab(p, *it) ? &*it : nullptr;
+    }
+
+public:
+    /**
+     * @brief Constructs an empty pool.
+     * @param blockSize The size of every block; rounded up to the fundamental alignment.
+     */
+    explicit NodePool(std::size_t blockSize)
+        : block_bytes((std::max(blockSize, sizeof(FreeBlock)) + alignment - 1) / alignment * alignment),
+          free_list(nullptr), free_blocks(0), lock(false) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+     * @brief Releases every slab and every block on the free list.
+     *
+     * Outstanding blocks must have been returned before the pool is destroyed.
+     */
+    ~NodePool() {
+        while (free_list) {
+            FreeBlock* block = free_list;
+            free_list = block->next;
+            if (!find_slab(block)) ::operator delete(block, std::align_val_t(alignment));
+        }
+        for (const Slab& slab : slabs) {
+            ::operator delete(slab.memory, std::align_val_t(alignment));
+        }
+    }
+
+    /**
+     * @brief Gets the size of every block.
+     * @return The block size in bytes.
+     */
+    std::size_t block_size() const { return block_bytes; }
+
+    /**
+     * @brief Gets the number of blocks ready to be handed out without allocating.
+     * @return The number of free blocks.
+     */
+    std::size_t free_count() {
+        Guard guard(lock);
+        return free_blocks;
+    }
+
+    /**
+     * @brief Hands out one block, allocating a new one if the free list is empty.
+     * @return Pointer to a block of block_size() bytes.
+     */
+    void* allocate() {
+        {
+            Guard guard(lock);
+            if (free_list) {
+                FreeBlock* block = free_list;
+                free_list = block->next;
+                --free_blocks;
+                return block;
+            }
+        }
+        return ::operator new(block_bytes, std::align_val_t(alignment));
+    }
+
+    /**
+     * @brief Returns a block to the free list.
+     * @param p Pointer previously returned by allocate().
+     */
+    void deallocate(void* p) noexcept {
+        Guard guard(lock);
+        FreeBlock* block = static_cast<FreeBlock*>(p);
+        block->next = free_list;
+        free_list = block;
+        ++free_blocks;
+    }
+
+    /**
+     * @brief Ensures at least n blocks are free, allocating the shortfall as one slab.
+     * @param n The number of blocks that must be free.
+     */
+    void reserve(std::size_t n) {
+        std::size_t missing;
+        {
+            Guard guard(lock);
+            if (free_blocks >= n) return;
+            missing = n - free_blocks;
+        }
+        auto* memory = static_cast<std::byte*>(::operator new(missing * block_bytes, std::align_val_t(alignment)));
+        Guard guard(lock);
+        Slab slab{memory, missing};
+        slabs.insert(std::upper_bound(slabs.begin(), slabs.end(), slab, [](const Slab& a, const Slab& b) {
+            return std::less<const void*>()(a.memory, b.memory);
+        }), slab);
+        for (std::size_t i = missing; i-- > 0;) {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(memory + i * block_bytes);
+            block->next = free_list;
+            free_list = block;
+        }
+        free_blocks += missing;
+    }
+
+    /**
+     * @brief Releases free blocks that were allocated individually and slabs with no block in use.
+     */
+    void shrink_to_fit() {
+        Guard guard(lock);
+        std::vector<std::size_t> freeInSlab(slabs.size(), 0);
+        for (FreeBlock* block = free_list; block; block = block->next) {
+            if (const Slab* slab = find_slab(block)) ++freeInSlab[static_cast<std::size_t>(slab - slabs.data())];
+        }
+        FreeBlock* kept = nullptr;
+        std::size_t keptCount = 0;
+        while (free_list) {
+            FreeBlock* block = free_list;
+            free_list = block->next;
+            const Slab* slab = find_slab(block);
+            if (!slab) {
+                ::operator delete(block, std::align_val_t(alignment));
+            } else if (freeInSlab[static_cast<std::size_t>(slab - slabs.data())] != slab->blocks) {
+                block->next = kept;
+                kept = block;
+                ++keptCount;
+            }
+        }
+        free_list = kept;
+        free_blocks = keptCount;
+        std::vector<Slab> remaining;
+        for (std::size_t i = 0; i < slabs.size(); ++i) {
+            if (freeInSlab[i] == slabs[i].blocks) {
+                ::operator delete(slabs[i].memory, std::align_val_t(alignment));
+            } else {
+                remaining.push_back(slabs[i]);
+            }
+        }
+        slabs = std::move(remaining);
+    }
+};
+
+/**
+ * @brief Allocator that serves single-object allocations of up to the pool's block size from a NodePool.
+ *
+ * Meant for std::allocate_shared, which rebinds it to its internal control block type. Larger or
+ * array allocations fall through to the global allocator. Every copy keeps the pool alive.
+ *
+ * @tparam U Type of objects allocated.
+ */
+template<typename U>
+class PoolAllocator {
+public:
+    using value_type = U;
+
+    template<typename V> friend class PoolAllocator;
+
+    /**
+     * @brief Constructs an allocator drawing from the given pool.
+     * @param nodePool The pool to allocate from.
+     */
+    explicit PoolAllocator(std::shared_ptr<NodePool> nodePool) noexcept : pool(std::move(nodePool)) {}
+
+    /**
+     * @brief Converting constructor used when rebinding.
+     * @param other The allocator to copy the pool from.
+     */
+    template<typename V>
+    PoolAllocator(const PoolAllocator<V>& other) noexcept : pool(other.pool) {}
+
+    /**
+     * @brief Allocates storage for n objects.
+     * @param n The number of objects.
+     * @return Pointer to the storage.
+     */
+    U* allocate(std::size_t n) {
+        if (uses_pool(n)) return static_cast<U*>(pool->allocate());
+        return static_cast<U*>(::operator new(n * sizeof(U), std::align_val_t(alignof(U))));
+    }
+
+    /**
+     * @brief Frees storage previously returned by allocate().
+     * @param p Pointer to the storage.
+     * @param n The number of objects passed to allocate().
+     */
+    void deallocate(U* p, std::size_t n) noexcept {
+        if (uses_pool(n)) {
+            pool->deallocate(p);
+        } else {
+            ::operator delete(p, std::align_val_t(alignof(U)));
+        }
+    }
+
+    template<typename V>
+    bool operator==(const PoolAllocator<V>& other) const noexcept { return pool == other.pool; }
+
+    template<typename V>
+    bool operator!=(const PoolAllocator<V>& other) const noexcept { return pool != other.pool; }
+
+private:
+    bool uses_pool(std::size_t n) const noexcept {
+        return n == 1 && sizeof(U) <= pool->block_size() && alignof(U) <= alignof(std::max_align_t);
+    }
+
+    std::shared_ptr<NodePool> pool; //!< The pool blocks are drawn from.
+};
+
+#endif // NODEPOOL_HPP
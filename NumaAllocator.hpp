@@ -0,0 +1,308 @@
+#ifndef NUMAALLOCATOR_HPP
+#define NUMAALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <mutex>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "SinglyLinkedList.hpp"
+
+/**
+ * @brief Small-object heaps whose slabs are bound to one NUMA node each.
+ *
+ * Every node gets a heap with one free list per 16-byte size class, refilled from 2 MiB slabs
+ * mapped with mmap and bound to the node with the mbind system call. The slab header records the
+ * heap that owns it, so a block can be freed from any thread without knowing where it came from.
+ * The syscalls are issued directly, without libnuma. On a machine with a single node, or where
+ * the kernel refuses the calls, the slabs are used as mapped and nothing else changes.
+ */
+class NumaHeap {
+public:
+    static constexpr std::size_t granularity = 16; //!< Size class step in bytes.
+    static constexpr std::size_t max_small_size = 512; //!< Largest size served from the node heaps.
+    static constexpr std::size_t slab_size = 2 * 1024 * 1024; //!< Size and alignment of a slab.
+    static constexpr std::size_t class_count = max_small_size / granularity;
+
+    /**
+     * @brief Gets the number of NUMA nodes on this machine.
+     * @return The node count; 1 if the topology cannot be read.
+     */
+    static int node_count() {
+        static const int count = read_node_count();
+        return count;
+    }
+
+    /**
+     * @brief Gets the node of the CPU the calling thread is running on.
+     * @return The node index; 0 if it cannot be determined.
+     */
+    static int current_node() {
+        unsigned cpu = 0, node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 || static_cast<int>(node) >= node_count()) return 0;
+        return static_cast<int>(node);
+    }
+
+    /**
+     * @brief Gets the node a page of memory currently resides on.
+     * @param p Any address inside the page; the page must have been touched.
+     * @return The node index, or -1 if the kernel cannot report it.
+     */
+    static int node_of(const void* p) {
+        void* page = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(p) & ~(page_size() - 1));
+        int status = -1;
+        if (syscall(SYS_move_pages, 0, 1UL, &page, nullptr, &status, 0) != 0 || status < 0) return -1;
+        return status;
+    }
+
+    /**
+     * @brief Checks whether an allocation is served from the node heaps.
+     * @param bytes The size of the allocation.
+     * @param align The alignment of the allocation.
+     * @return True if the allocation is placed on a node.
+     */
+    static bool is_small(std::size_t bytes, std::size_t align) {
+        return bytes <= max_small_size && align <= granularity;
+    }
+
+    /**
+     * @brief Allocates a small block on a node.
+     * @param bytes The size of the block; must satisfy is_small().
+     * @param node The node to place the block on, or -1 for the calling thread's node.
+     * @return Pointer to the block.
+     */
+    static void* allocate(std::size_t bytes, int node) {
+        if (node < 0 || node >= node_count()) node = current_node();
+        return heap(node).allocate(size_class(bytes));
+    }
+
+    /**
+     * @brief Returns a block to the heap of the node it was placed on.
+     * @param p Pointer previously returned by allocate().
+     */
+    static void deallocate(void* p) noexcept {
+        SlabHeader* slab = slab_of(p);
+        slab->owner->deallocate(static_cast<FreeBlock*>(p), slab->size_class);
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next; //!< Next block in a free list.
+    };
+
+    struct Heap;
+
+    /**
+     * @brief Header at the start of every slab.
+     */
+    struct alignas(64) SlabHeader {
+        Heap* owner; //!< Heap that carved the slab.
+        std::size_t size_class; //!< Size class of every block in the slab.
+    };
+
+    static constexpr unsigned long mpol_preferred = 1; //!< MPOL_PREFERRED from <numaif.h>.
+
+    static std::size_t size_class(std::size_t bytes) {
+        return bytes == 0 ? 0 : (bytes - 1) / granularity;
+    }
+
+    static SlabHeader* slab_of(const void* p) {
+        return reinterpret_cast<SlabHeader*>(reinterpret_cast<std::uintptr_t>(p) & ~(slab_size - 1));
+    }
+
+    static std::size_t page_size() {
+        static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        return size;
+    }
+
+    static int read_node_count() {
+        std::FILE* file = std::fopen("/sys/devices/system/node/online", "r");
+        if (!file) return 1;
+        int last = 0, value = 0;
+        char separator = 0;
+        while (std::fscanf(file, "%d%c", &value, &separator) >= 1) {
+            last = std::max(last, value);
+            if (separator == '\n') break;
+        }
+        std::fclose(file);
+        return last + 1;
+    }
+
+    /**
+     * @brief Maps one slab-aligned slab and binds it to a node.
+     * @param node The node to bind the slab to.
+     * @return Pointer to the slab.
+     */
+    static std::byte* map_slab(int node) {
+        void* raw = mmap(nullptr, 2 * slab_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) throw std::bad_alloc();
+        auto start = reinterpret_cast<std::uintptr_t>(raw);
+        auto aligned = (start + slab_size - 1) & ~(slab_size - 1);
+        if (aligned > start) munmap(raw, aligned - start);
+        if (aligned + slab_size < start + 2 * slab_size) {
+            munmap(reinterpret_cast<void*>(aligned + slab_size), start + 2 * slab_size - aligned - slab_size);
+        }
+        if (node_count() > 1) {
+            unsigned long mask[16] = {};
+            mask[static_cast<std::size_t>(node) / (8 * sizeof(unsigned long))] = 1UL << (static_cast<std::size_t>(node) % (8 * sizeof(unsigned long)));
+            syscall(SYS_mbind, aligned, slab_size, mpol_preferred, mask, 8 * sizeof(mask), 0UL);
+        }
+        return reinterpret_cast<std::byte*>(aligned);
+    }
+
+    /**
+     * @brief The free lists and slabs of one node.
+     */
+    struct Heap {
+        int node; //!< The node every slab is bound to.
+        std::mutex mutex; //!< Guards every member below.
+        FreeBlock* free_lists[class_count] = {}; //!< Freed blocks per size class.
+        std::byte* bump[class_count] = {}; //!< Next uncarved block per size class.
+        std::byte* bump_end[class_count] = {}; //!< End of the slab being carved per size class.
+
+        explicit Heap(int nodeIndex) : node(nodeIndex) {}
+
+        void* allocate(std::size_t c) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (FreeBlock* block = free_lists[c]) {
+                free_lists[c] = block->next;
+                return block;
+            }
+            std::size_t bytes = (c + 1) * granularity;
+            if (bump[c] == nullptr || bump[c] + bytes > bump_end[c]) {
+                std::byte* slab = map_slab(node);
+                auto* header = new (slab) SlabHeader{this, c};
+                bump[c] = slab + sizeof(*header);
+                bump_end[c] = slab + slab_size;
+            }
+            void* block = bump[c];
+            bump[c] += bytes;
+            return block;
+        }
+
+        void deallocate(FreeBlock* block, std::size_t c) noexcept {
+            std::lock_guard<std::mutex> lock(mutex);
+            block->next = free_lists[c];
+            free_lists[c] = block;
+        }
+    };
+
+    static Heap& heap(int node) {
+        static std::vector<Heap*>* heaps = [] {
+            auto* all = new std::vector<Heap*>();
+            for (int n = 0; n < node_count(); ++n) all->push_back(new Heap(n));
+            return all;
+        }();
+        return *(*heaps)[static_cast<std::size_t>(node)];
+    }
+};
+
+/**
+ * @brief Standard allocator that places small objects on a chosen NUMA node.
+ *
+ * Memory may be freed through any NumaAllocator regardless of its node, so all instances compare
+ * equal. Allocations larger than NumaHeap::max_small_size, or over-aligned ones, use the global
+ * allocator and are not placed.
+ *
+ * @tparam T Type of objects allocated.
+ */
+template<typename T>
+class NumaAllocator {
+public:
+    using value_type = T;
+
+    template<typename U> friend class NumaAllocator;
+
+    /**
+     * @brief Constructs an allocator placing objects on a node.
+     * @param nodeIndex The node, or -1 for the node of whichever thread allocates.
+     */
+    explicit NumaAllocator(int nodeIndex = -1) noexcept : target(nodeIndex) {}
+
+    template<typename U>
+    NumaAllocator(const NumaAllocator<U>& other) noexcept : target(other.target) {}
+
+    /**
+     * @brief Gets the node objects are placed on.
+     * @return The node index, or -1 for the allocating thread's node.
+     */
+    int node() const noexcept { return target; }
+
+    /**
+     * @brief Allocates storage for n objects.
+     * @param n The number of objects.
+     * @return Pointer to the storage.
+     */
+    T* allocate(std::size_t n) {
+        if (is_small(n)) {
+            return static_cast<T*>(NumaHeap::allocate(n * sizeof(T), target));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    }
+
+    /**
+     * @brief Frees storage previously returned by allocate().
+     * @param p Pointer to the storage.
+     * @param n The number of objects passed to allocate().
+     */
+    void deallocate(T* p, std::size_t n) noexcept {
+        if (is_small(n)) {
+            NumaHeap::deallocate(p);
+        } else {
+            ::operator delete(p, std::align_val_t(alignof(T)));
+        }
+    }
+
+    template<typename U>
+    bool operator==(const NumaAllocator<U>&) const noexcept { return true; }
+
+    template<typename U>
+    bool operator!=(const NumaAllocator<U>&) const noexcept { return false; }
+
+private:
+    static bool is_small(std::size_t n) noexcept {
+        return n <= NumaHeap::max_small_size / sizeof(T) && NumaHeap::is_small(n * sizeof(T), alignof(T));
+    }
+
+    int target; //!< The node objects are placed on, or -1 for the allocating thread's node.
+};
+
+/**
+ * @brief Moves every element of a list into nodes placed on a NUMA node.
+ *
+ * The elements are moved in order into freshly allocated nodes, which then replace the list's
+ * chain; the old nodes are freed as they are emptied. Lists built on one node and scanned from
+ * another should be migrated to the scanning thread's node first. The list no longer shares its
+ * nodes with any aliasing copies afterwards.
+ *
+ * If allocating a node or moving an element throws, the elements already moved are relinked in
+ * front of the rest, so the list keeps every element in order and its allocator. Only an element
+ * whose move constructor throws after modifying its source is left changed.
+ *
+ * @param list The list to migrate.
+ * @param node The node to place the nodes on, or -1 for the calling thread's node.
+ */
+template<typename T>
+void migrate_to_node(SinglyLinkedList<T, NumaAllocator<T>>& list, int node = -1) {
+    if (node < 0 || node >= NumaHeap::node_count()) node = NumaHeap::current_node();
+    SinglyLinkedList<T, NumaAllocator<T>> placed{NumaAllocator<T>(node)};
+    try {
+        while (!list.empty()) {
+            placed.push_back(std::move(list.front()));
+            list.pop_front();
+        }
+    } catch (...) {
+        placed.splice_back(list);
+        list.splice_back(placed);
+        throw;
+    }
+    list = std::move(placed);
+}
+
+#endif // NUMAALLOCATOR_HPP
@@ -0,0 +1,70 @@
+#include "NumaAllocator.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <stdexcept>
+#include <thread>
+
+struct Fragile {
+    int value;
+    static inline int moves = 0;
+    explicit Fragile(int v) : value(v) {}
+    Fragile(Fragile&& other) : value(other.value) {
+        if (++moves == 50) throw std::runtime_error("move failed");
+    }
+};
+
+int main() {
+    std::cout << "NumaAllocator MWE test starts!\n";
+
+    // Test the topology queries on any machine, including single-node ones
+    int nodes = NumaHeap::node_count();
+    assert(nodes >= 1);
+    int local = NumaHeap::current_node();
+    assert(local >= 0 && local < nodes);
+    std::cout << "0\n";
+
+    // Test a list placed on the local node
+    using List = SinglyLinkedList<int, NumaAllocator<int>>;
+    List list{NumaAllocator<int>(local)};
+    for (int i = 0; i < 10000; ++i) list.push_back(i);
+    assert(list.size() == 10000 && list.get_allocator().node() == local);
+    int placed = NumaHeap::node_of(&list.front());
+    assert(placed == -1 || placed == local);
+    std::cout << "1\n";
+
+    // Test migrating keeps the order and the values, and falls back for unknown nodes
+    migrate_to_node(list, nodes - 1);
+    assert(list.size() == 10000 && list.front() == 0 && list.back() == 9999);
+    assert(list.get_allocator().node() == nodes - 1);
+    migrate_to_node(list, nodes + 7);
+    assert(list.size() == 10000 && list.get_allocator().node() == local);
+    SinglyLinkedList<std::string, NumaAllocator<std::string>> strings;
+    strings.push_back("alpha");
+    strings.push_back(std::string(100, 'z'));
+    migrate_to_node(strings);
+    assert(strings.front() == "alpha" && strings.back().size() == 100);
+    SinglyLinkedList<Fragile, NumaAllocator<Fragile>> fragile{NumaAllocator<Fragile>(local)};
+    for (int i = 0; i < 100; ++i) fragile.emplace_back(i);
+    bool thrown = false;
+    try {
+        migrate_to_node(fragile, nodes - 1);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && fragile.size() == 100 && fragile.get_allocator().node() == local);
+    int expected = 0;
+    for (const Fragile& f : fragile) assert(f.value == expected++);
+    std::cout << "2\n";
+
+    // Test nodes freed on another thread than the one that placed them
+    std::thread other([&] { list.clear(); });
+    other.join();
+    assert(list.empty());
+    list.push_back(1);
+    assert(list.front() == 1);
+    std::cout << "3\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
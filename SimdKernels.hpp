@@ -0,0 +1,525 @@
+#ifndef SIMDKERNELS_HPP
+#define SIMDKERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(__GNUC__)
+#define SIMDKERNELS_X86 1
+#include <immintrin.h>
+#else
+#define SIMDKERNELS_X86 0
+#endif
+
+/**
+ * @brief Vectorized search and reduction kernels over contiguous storage.
+ *
+ * The kernels operate on a contiguous range [first, last) of an arithmetic type. On x86-64 the
+ * best available instruction set (AVX2 or SSE2) is detected once at runtime; every other target
+ * uses the scalar fallback. All kernels return the same results as their scalar equivalents,
+ * except that floating-point sums are accumulated in a different order and NaN inputs give an
+ * unspecified result for min and max.
+ */
+namespace simd {
+
+/**
+ * @brief Instruction sets the kernels can dispatch to.
+ */
+enum class Isa { Scalar, SSE2, AVX2 };
+
+/**
+ * @brief Detects the best instruction set supported by the running CPU.
+ * @return The detected instruction set, cached after the first call.
+ */
+inline Isa detected_isa() {
+#if SIMDKERNELS_X86
+    static const Isa isa = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") ? Isa::AVX2 : Isa::SSE2;
+    }();
+    return isa;
+#else
+    return Isa::Scalar;
+#endif
+}
+
+namespace detail {
+
+template<typename T>
+constexpr bool is_float_lane = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+template<typename T>
+constexpr bool is_int_lane = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+template<typename T>
+constexpr bool has_vector_minmax = is_float_lane<T> || std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::uint32_t>;
+
+template<typename T>
+constexpr bool has_vector_sum = is_float_lane<T> || (is_int_lane<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+
+template<typename T>
+const T* find_scalar(const T* first, const T* last, const T& value) {
+    for (; first != last; ++first) {
+        if (*first == value) return first;
+    }
+    return last;
+}
+
+template<typename T>
+std::size_t count_scalar(const T* first, const T* last, const T& value) {
+    std::size_t n = 0;
+    for (; first != last; ++first) {
+        n += (*first == value);
+    }
+    return n;
+}
+
+template<typename T>
+T min_scalar(const T* first, const T* last) {
+    T result = *first;
+    for (++first; first != last; ++first) {
+        if (*first < result) result = *first;
+    }
+    return result;
+}
+
+template<typename T>
+T max_scalar(const T* first, const T* last) {
+    T result = *first;
+    for (++first; first != last; ++first) {
+        if (result < *first) result = *first;
+    }
+    return result;
+}
+
+/**
+ * @brief Adds two elements, wrapping around on integer overflow instead of overflowing a signed type.
+ */
+template<typename T>
+T wrapping_add(T a, T b) {
+    if constexpr (is_int_lane<T>) {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<T>(static_cast<U>(static_cast<U>(a) + static_cast<U>(b)));
+    } else {
+        return a + b;
+    }
+}
+
+template<typename T>
+T sum_scalar(const T* first, const T* last) {
+    T result = T();
+    for (; first != last; ++first) {
+        result = wrapping_add(result, *first);
+    }
+    return result;
+}
+
+template<typename T>
+bool equal_scalar(const T* first1, const T* last1, const T* first2) {
+    for (; first1 != last1; ++first1, ++first2) {
+        if (!(*first1 == *first2)) return false;
+    }
+    return true;
+}
+
+#if SIMDKERNELS_X86
+
+/**
+ * @brief Returns a byte mask of the lanes of two 16-byte blocks that compare equal.
+ *
+ * Every matching element sets sizeof(T) consecutive bits of the result.
+ */
+template<typename T>
+inline unsigned eq_mask_sse2(__m128i a, __m128i b) {
+    if constexpr (std::is_same_v<T, float>) {
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)))));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)))));
+    } else if constexpr (sizeof(T) == 1) {
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+    } else if constexpr (sizeof(T) == 2) {
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(a, b)));
+    } else if constexpr (sizeof(T) == 4) {
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi32(a, b)));
+    } else {
+        __m128i c = _mm_cmpeq_epi32(a, b);
+        c = _mm_and_si128(c, _mm_shuffle_epi32(c, _MM_SHUFFLE(2, 3, 0, 1)));
+        return static_cast<unsigned>(_mm_movemask_epi8(c));
+    }
+}
+
+template<typename T>
+__attribute__((target("avx2"))) inline unsigned eq_mask_avx2(__m256i a, __m256i b) {
+    if constexpr (std::is_same_v<T, float>) {
+        return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ))));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ))));
+    } else if constexpr (sizeof(T) == 1) {
+        return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+    } else if constexpr (sizeof(T) == 2) {
+        return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(a, b)));
+    } else if constexpr (sizeof(T) == 4) {
+        return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, b)));
+    } else {
+        return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(a, b)));
+    }
+}
+
+template<typename T>
+inline __m128i splat_sse2(const T& value) {
+    alignas(16) T lanes[16 / sizeof(T)];
+    for (auto& lane : lanes) lane = value;
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(lanes));
+}
+
+template<typename T>
+__attribute__((target("avx2"))) inline __m256i splat_avx2(const T& value) {
+    alignas(32) T lanes[32 / sizeof(T)];
+    for (auto& lane : lanes) lane = value;
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes));
+}
+
+template<typename T>
+const T* find_sse2(const T* first, const T* last, const T& value) {
+    constexpr std::size_t lanes = 16 / sizeof(T);
+    const __m128i needle = splat_sse2(value);
+    for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) {
+        unsigned mask = eq_mask_sse2<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), needle);
+        if (mask) return first + __builtin_ctz(mask) / sizeof(T);
+    }
+    return find_scalar(first, last, value);
+}
+
+template<typename T>
+__attribute__((target("avx2"))) const T* find_avx2(const T* first, const T* last, const T& value) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    const __m256i needle = splat_avx2(value);
+    for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) {
+        unsigned mask = eq_mask_avx2<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), needle);
+        if (mask) return first + __builtin_ctz(mask) / sizeof(T);
+    }
+    return find_scalar(first, last, value);
+}
+
+template<typename T>
+std::size_t count_sse2(const T* first, const T* last, const T& value) {
+    constexpr std::size_t lanes = 16 / sizeof(T);
+    const __m128i needle = splat_sse2(value);
+    std::size_t bits = 0;
+    for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) {
+        bits += __builtin_popcount(eq_mask_sse2<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), needle));
+    }
+    return bits / sizeof(T) + count_scalar(first, last, value);
+}
+
+template<typename T>
+__attribute__((target("avx2"))) std::size_t count_avx2(const T* first, const T* last, const T& value) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    const __m256i needle = splat_avx2(value);
+    std::size_t bits = 0;
+    for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) {
+        bits += __builtin_popcount(eq_mask_avx2<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), needle));
+    }
+    return bits / sizeof(T) + count_scalar(first, last, value);
+}
+
+template<typename T>
+bool equal_sse2(const T* first1, const T* last1, const T* first2) {
+    constexpr std::size_t lanes = 16 / sizeof(T);
+    for (; static_cast<std::size_t>(last1 - first1) >= lanes; first1 += lanes, first2 += lanes) {
+        unsigned mask = eq_mask_sse2<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first1)),
+                                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(first2)));
+        if (mask != 0xFFFFu) return false;
+    }
+    return equal_scalar(first1, last1, first2);
+}
+
+template<typename T>
+__attribute__((target("avx2"))) bool equal_avx2(const T* first1, const T* last1, const T* first2) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    for (; static_cast<std::size_t>(last1 - first1) >= lanes; first1 += lanes, first2 += lanes) {
+        unsigned mask = eq_mask_avx2<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first1)),
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first2)));
+        if (mask != 0xFFFFFFFFu) return false;
+    }
+    return equal_scalar(first1, last1, first2);
+}
+
+/**
+ * @brief Reduces [first, last) with a vertical min or max, then folds the lanes.
+ * @tparam Max True for max, false for min.
+ */
+template<bool Max, typename T>
+T minmax_sse2(const T* first, const T* last) {
+    if constexpr (std::is_same_v<T, float>) {
+        if (last - first < 4) return Max ? max_scalar(first, last) : min_scalar(first, last);
+        __m128 acc = _mm_loadu_ps(first);
+        for (first += 4; last - first >= 4; first += 4) {
+            __m128 v = _mm_loadu_ps(first);
+            acc = Max ? _mm_max_ps(acc, v) : _mm_min_ps(acc, v);
+        }
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, acc);
+        T result = Max ? max_scalar(lanes, lanes + 4) : min_scalar(lanes, lanes + 4);
+        for (; first != last; ++first) result = Max ? (result < *first ? *first : result) : (*first < result ? *first : result);
+        return result;
+    } else if constexpr (std::is_same_v<T, double>) {
+        if (last - first < 2) return Max ? max_scalar(first, last) : min_scalar(first, last);
+        __m128d acc = _mm_loadu_pd(first);
+        for (first += 2; last - first >= 2; first += 2) {
+            __m128d v = _mm_loadu_pd(first);
+            acc = Max ? _mm_max_pd(acc, v) : _mm_min_pd(acc, v);
+        }
+        alignas(16) double lanes[2];
+        _mm_store_pd(lanes, acc);
+        T result = Max ? max_scalar(lanes, lanes + 2) : min_scalar(lanes, lanes + 2);
+        for (; first != last; ++first) result = Max ? (result < *first ? *first : result) : (*first < result ? *first : result);
+        return result;
+    } else {
+        return Max ? max_scalar(first, last) : min_scalar(first, last);
+    }
+}
+
+template<bool Max, typename T>
+__attribute__((target("avx2"))) T minmax_avx2(const T* first, const T* last) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    if (static_cast<std::size_t>(last - first) < lanes) return Max ? max_scalar(first, last) : min_scalar(first, last);
+    alignas(32) T folded[lanes];
+    if constexpr (std::is_same_v<T, float>) {
+        __m256 acc = _mm256_loadu_ps(first);
+        for (first += lanes; static_cast<std::size_t>(last - first) >= lanes; first += lanes) {
+            __m256 v = _mm256_loadu_ps(first);
+            acc = Max ? _mm256_max_ps(acc, v) : _mm256_min_ps(acc, v);
+        }
+        _mm256_store_ps(folded, acc);
+    } else if constexpr (std::is_same_v<T, double>) {
+        __m256d acc = _mm256_loadu_pd(first);
+        for (first += lanes; static_cast<std::size_t>(last - first) >= lanes; first += lanes) {
+            __m256d v = _mm256_loadu_pd(first);
+            acc = Max ? _mm256_max_pd(acc, v) : _mm256_min_pd(acc, v);
+        }
+        _mm256_store_pd(folded, acc);
+    } else {
+        __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        for (first += lanes; static_cast<std::size_t>(last - first) >= lanes; first += lanes) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            if constexpr (std::is_signed_v<T>) {
+                acc = Max ? _mm256_max_epi32(acc, v) : _mm256_min_epi32(acc, v);
+            } else {
+                acc = Max ? _mm256_max_epu32(acc, v) : _mm256_min_epu32(acc, v);
+            }
+        }
+        _mm256_store_si256(reinterpret_cast<__m256i*>(folded), acc);
+    }
+    T result = Max ? max_scalar(folded, folded + lanes) : min_scalar(folded, folded + lanes);
+    for (; first != last; ++first) result = Max ? (result < *first ? *first : result) : (*first < result ? *first : result);
+    return result;
+}
+
+template<typename T>
+T sum_sse2(const T* first, const T* last) {
+    constexpr std::size_t lanes = 16 / sizeof(T);
+    alignas(16) T folded[lanes];
+    if constexpr (std::is_same_v<T, float>) {
+        __m128 acc = _mm_setzero_ps();
+        for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) acc = _mm_add_ps(acc, _mm_loadu_ps(first));
+        _mm_store_ps(folded, acc);
+    } else if constexpr (std::is_same_v<T, double>) {
+        __m128d acc = _mm_setzero_pd();
+        for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) acc = _mm_add_pd(acc, _mm_loadu_pd(first));
+        _mm_store_pd(folded, acc);
+    } else {
+        __m128i acc = _mm_setzero_si128();
+        for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            acc = sizeof(T) == 4 ? _mm_add_epi32(acc, v) : _mm_add_epi64(acc, v);
+        }
+        _mm_store_si128(reinterpret_cast<__m128i*>(folded), acc);
+    }
+    return wrapping_add(sum_scalar(folded, folded + lanes), sum_scalar(first, last));
+}
+
+template<typename T>
+__attribute__((target("avx2"))) T sum_avx2(const T* first, const T* last) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    alignas(32) T folded[lanes];
+    if constexpr (std::is_same_v<T, float>) {
+        __m256 acc = _mm256_setzero_ps();
+        for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) acc = _mm256_add_ps(acc, _mm256_loadu_ps(first));
+        _mm256_store_ps(folded, acc);
+    } else if constexpr (std::is_same_v<T, double>) {
+        __m256d acc = _mm256_setzero_pd();
+        for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) acc = _mm256_add_pd(acc, _mm256_loadu_pd(first));
+        _mm256_store_pd(folded, acc);
+    } else {
+        __m256i acc = _mm256_setzero_si256();
+        for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            acc = sizeof(T) == 4 ? _mm256_add_epi32(acc, v) : _mm256_add_epi64(acc, v);
+        }
+        _mm256_store_si256(reinterpret_cast<__m256i*>(folded), acc);
+    }
+    return wrapping_add(sum_scalar(folded, folded + lanes), sum_scalar(first, last));
+}
+
+#endif // SIMDKERNELS_X86
+
+template<typename T>
+void require_arithmetic() {
+    static_assert(std::is_arithmetic_v<T>, "simd kernels require an arithmetic element type.");
+}
+
+} // namespace detail
+
+/**
+ * @brief Finds the first element equal to a value.
+ * @param first Pointer to the first element.
+ * @param last Pointer one past the last element.
+ * @param value The value to search for.
+ * @return Pointer to the first matching element, or last if there is none.
+ */
+template<typename T>
+const T* find(const T* first, const T* last, const T& value) {
+    detail::require_arithmetic<T>();
+#if SIMDKERNELS_X86
+    if constexpr (!std::is_same_v<T, bool> && !std::is_same_v<T, long double>) {
+        switch (detected_isa()) {
+            case Isa::AVX2: return detail::find_avx2(first, last, value);
+            case Isa::SSE2: return detail::find_sse2(first, last, value);
+            default: break;
+        }
+    }
+#endif
+    return detail::find_scalar(first, last, value);
+}
+
+/**
+ * @brief Counts the elements equal to a value.
+ * @param first Pointer to the first element.
+ * @param last Pointer one past the last element.
+ * @param value The value to count.
+ * @return The number of matching elements.
+ */
+template<typename T>
+std::size_t count(const T* first, const T* last, const T& value) {
+    detail::require_arithmetic<T>();
+#if SIMDKERNELS_X86
+    if constexpr (!std::is_same_v<T, bool> && !std::is_same_v<T, long double>) {
+        switch (detected_isa()) {
+            case Isa::AVX2: return detail::count_avx2(first, last, value);
+            case Isa::SSE2: return detail::count_sse2(first, last, value);
+            default: break;
+        }
+    }
+#endif
+    return detail::count_scalar(first, last, value);
+}
+
+/**
+ * @brief Computes the smallest element of a non-empty range.
+ * @param first Pointer to the first element.
+ * @param last Pointer one past the last element.
+ * @return The smallest element.
+ * @throws std::runtime_error if the range is empty.
+ */
+template<typename T>
+T min(const T* first, const T* last) {
+    detail::require_arithmetic<T>();
+    if (first == last) {
+        throw std::runtime_error("Range is empty: cannot compute min.");
+    }
+#if SIMDKERNELS_X86
+    if constexpr (detail::has_vector_minmax<T>) {
+        switch (detected_isa()) {
+            case Isa::AVX2: return detail::minmax_avx2<false>(first, last);
+            case Isa::SSE2: return detail::minmax_sse2<false>(first, last);
+            default: break;
+        }
+    }
+#endif
+    return detail::min_scalar(first, last);
+}
+
+/**
+ * @brief Computes the largest element of a non-empty range.
+ * @param first Pointer to the first element.
+ * @param last Pointer one past the last element.
+ * @return The largest element.
+ * @throws std::runtime_error if the range is empty.
+ */
+template<typename T>
+T max(const T* first, const T* last) {
+    detail::require_arithmetic<T>();
+    if (first == last) {
+        throw std::runtime_error("Range is empty: cannot compute max.");
+    }
+#if SIMDKERNELS_X86
+    if constexpr (detail::has_vector_minmax<T>) {
+        switch (detected_isa()) {
+            case Isa::AVX2: return detail::minmax_avx2<true>(first, last);
+            case Isa::SSE2: return detail::minmax_sse2<true>(first, last);
+            default: break;
+        }
+    }
+#endif
+    return detail::max_scalar(first, last);
+}
+
+/**
+ * @brief Sums the elements of a range.
+ *
+ * Integer sums wrap around on overflow. Floating-point sums are accumulated per lane, so the
+ * result may differ from a sequential sum in the last bits.
+ *
+ * @param first Pointer to the first element.
+ * @param last Pointer one past the last element.
+ * @return The sum of the elements, or T() for an empty range.
+ */
+template<typename T>
+T sum(const T* first, const T* last) {
+    detail::require_arithmetic<T>();
+#if SIMDKERNELS_X86
+    if constexpr (detail::has_vector_sum<T>) {
+        switch (detected_isa()) {
+            case Isa::AVX2: return detail::sum_avx2(first, last);
+            case Isa::SSE2: return detail::sum_sse2(first, last);
+            default: break;
+        }
+    }
+#endif
+    return detail::sum_scalar(first, last);
+}
+
+/**
+ * @brief Checks whether two ranges of the same length hold equal elements.
+ * @param first1 Pointer to the first element of the first range.
+ * @param last1 Pointer one past the last element of the first range.
+ * @param first2 Pointer to the first element of the second range.
+ * @return True if every pair of elements compares equal.
+ */
+template<typename T>
+bool equal(const T* first1, const T* last1, const T* first2) {
+    detail::require_arithmetic<T>();
+    if (first1 == last1) return true;
+    if constexpr (detail::is_int_lane<T>) {
+        return std::memcmp(first1, first2, static_cast<std::size_t>(last1 - first1) * sizeof(T)) == 0;
+    } else {
+#if SIMDKERNELS_X86
+        if constexpr (detail::is_float_lane<T>) {
+            switch (detected_isa()) {
+                case Isa::AVX2: return detail::equal_avx2(first1, last1, first2);
+                case Isa::SSE2: return detail::equal_sse2(first1, last1, first2);
+                default: break;
+            }
+        }
+#endif
+        return detail::equal_scalar(first1, last1, first2);
+    }
+}
+
+} // namespace simd
+
+#endif // SIMDKERNELS_HPP
@@ -0,0 +1,100 @@
+#include "SimdKernels.hpp"
+#include "SinglyLinkedList.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+template<typename T>
+void checkAgainstScalar(const std::vector<T>& values, T needle) {
+    const T* first = values.data();
+    const T* last = values.data() + values.size();
+    assert(simd::find(first, last, needle) == std::find(first, last, needle));
+    assert(simd::count(first, last, needle) == static_cast<std::size_t>(std::count(first, last, needle)));
+    assert(simd::equal(first, last, first));
+    if (!values.empty()) {
+        assert(simd::min(first, last) == *std::min_element(first, last));
+        assert(simd::max(first, last) == *std::max_element(first, last));
+        std::vector<T> changed(values);
+        changed.back() = static_cast<T>(changed.back() + 1);
+        assert(!simd::equal(first, last, changed.data()));
+    }
+}
+
+int main() {
+    std::cout << "SimdKernels MWE test starts!\n";
+
+    // Test every kernel against the scalar algorithms across vector and tail lengths
+    for (std::size_t n = 0; n < 100; ++n) {
+        std::vector<std::int32_t> ints(n);
+        std::vector<std::uint32_t> uints(n);
+        std::vector<std::int64_t> longs(n);
+        std::vector<std::uint8_t> bytes(n);
+        std::vector<std::int16_t> shorts(n);
+        std::vector<float> floats(n);
+        std::vector<double> doubles(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            ints[i] = static_cast<std::int32_t>((i * 7919) % 101) - 50;
+            uints[i] = static_cast<std::uint32_t>((i * 7919) % 101) + 3000000000u;
+            longs[i] = static_cast<std::int64_t>((i * 7919) % 101) << 40;
+            bytes[i] = static_cast<std::uint8_t>((i * 31) % 7);
+            shorts[i] = static_cast<std::int16_t>((i * 13) % 11) - 5;
+            floats[i] = static_cast<float>((i * 7919) % 101) * 0.5f - 10.0f;
+            doubles[i] = static_cast<double>((i * 7919) % 101) * 0.25 - 10.0;
+        }
+        checkAgainstScalar(ints, std::int32_t(7));
+        checkAgainstScalar(uints, 3000000042u);
+        checkAgainstScalar(longs, std::int64_t(42) << 40);
+        checkAgainstScalar(bytes, std::uint8_t(3));
+        checkAgainstScalar(shorts, std::int16_t(-2));
+        checkAgainstScalar(floats, 5.0f);
+        checkAgainstScalar(doubles, 2.5);
+        assert(simd::sum(ints.data(), ints.data() + n) == std::accumulate(ints.begin(), ints.end(), std::int32_t(0)));
+        assert(simd::sum(longs.data(), longs.data() + n) == std::accumulate(longs.begin(), longs.end(), std::int64_t(0)));
+        assert(simd::sum(doubles.data(), doubles.data() + n) == std::accumulate(doubles.begin(), doubles.end(), 0.0));
+    }
+    std::cout << "0\n";
+
+    // Test empty ranges
+    const int* none = nullptr;
+    assert(simd::find(none, none, 1) == none);
+    assert(simd::count(none, none, 1) == 0);
+    assert(simd::sum(none, none) == 0);
+    const std::int32_t overflowing[] = {std::numeric_limits<std::int32_t>::max(), 1, std::numeric_limits<std::int32_t>::max(), 3};
+    for (std::size_t n = 0; n <= 4; ++n) {
+        std::uint32_t expected = 0;
+        for (std::size_t i = 0; i < n; ++i) expected += static_cast<std::uint32_t>(overflowing[i]);
+        assert(simd::sum(overflowing, overflowing + n) == static_cast<std::int32_t>(expected));
+    }
+    const std::int16_t shorts[] = {std::numeric_limits<std::int16_t>::max(), 1};
+    assert(simd::sum(shorts, shorts + 2) == std::numeric_limits<std::int16_t>::min());
+    assert(simd::equal(none, none, none));
+    bool thrown = false;
+    try {
+        simd::min(none, none);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "1\n";
+
+    // Test floating-point equality semantics
+    std::vector<double> zeros = {0.0, 1.0, 2.0, 3.0, 4.0};
+    std::vector<double> negativeZeros = {-0.0, 1.0, 2.0, 3.0, 4.0};
+    assert(simd::equal(zeros.data(), zeros.data() + zeros.size(), negativeZeros.data()));
+    assert(simd::find(negativeZeros.data(), negativeZeros.data() + 5, 0.0) == negativeZeros.data());
+    std::cout << "2\n";
+
+    // Test kernels over a frozen snapshot of a list
+    SinglyLinkedList<float> list = {1.5f, -2.0f, 8.25f, 3.0f};
+    std::vector<float> frozen = list.to_vector();
+    assert(simd::max(frozen.data(), frozen.data() + frozen.size()) == 8.25f);
+    assert(simd::min(frozen.data(), frozen.data() + frozen.size()) == -2.0f);
+    assert(simd::sum(frozen.data(), frozen.data() + frozen.size()) == 10.75f);
+    std::cout << "3\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -10,6 +10,25 @@
 #include <vector>
 #include <array>
 #include <list>
+#include <future>
+#include <limits>
+#include <optional>
+#include <span>
+#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <random>
+#include <thread>
+#include <exception>
+#include <compare>
+#include <atomic>
+#include <version>
+#if defined(__cpp_lib_containers_ranges)
+#include <ranges>
+#endif
+#include "AsyncReclaimer.hpp"
+#include "NodePool.hpp"
 
 /**
  * @brief A singly linked list implementation.
@@ -19,8 +38,10 @@
  * to convert the list to various standard containers.
  * 
  * @tparam T Type of elements stored in the list.
+ * @tparam Allocator Allocator used for the nodes; rebound by std::allocate_shared to the node and
+ *         its reference count, which share one allocation.
  */
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class SinglyLinkedList {
 private:
     /**
@@ -38,6 +59,13 @@ private:
          */
         Node(T value) : data(std::move(value)), next(nullptr) {}
 
+        /**
+         * @brief Constructs a Node whose data is built in place.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template<typename... Args>
+        explicit Node(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
+
         /**
          * @brief Copy constructor for Node.
          * @param other The Node to copy.
@@ -80,18 +108,663 @@ private:
     std::shared_ptr<Node> head; //!< Pointer to the first node in the list.
     Node* tail; //!< Pointer to the last node in the list.
     std::size_t list_size; //!< Number of elements in the list.
+    std::shared_ptr<NodePool> pool; //!< Free chain of pre-allocated nodes, created by reserve().
+    [[no_unique_address]] Allocator alloc; //!< Allocator for nodes not taken from the pool.
+
+    /**
+     * @brief Polynomial hash of the elements modulo 2^61 - 1, maintained once track_hash() is called.
+     */
+    struct RollingHash {
+        std::uint64_t value = 0; //!< Sum over the elements of h(e_i) * base^(n - 1 - i).
+        std::uint64_t power = 1; //!< base^n.
+        bool tracked = false; //!< Whether track_hash() has been called.
+        std::atomic<bool> valid = false; //!< Whether value and power describe the current elements.
+        std::atomic<bool> shared = false; //!< Whether the nodes may be shared with an aliasing copy.
+
+        RollingHash() = default;
+
+        RollingHash(const RollingHash& other)
+            : value(other.value), power(other.power), tracked(other.tracked),
+              valid(other.valid.load(std::memory_order_relaxed)), shared(other.shared.load(std::memory_order_relaxed)) {}
+
+        RollingHash& operator=(const RollingHash& other) {
+            value = other.value;
+            power = other.power;
+            tracked = other.tracked;
+            valid.store(other.valid.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            shared.store(other.shared.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+    };
+
+    /**
+     * @brief The content hash.
+     *
+     * Through a const list, only the flags are written: valid by the accessors handing out
+     * references to elements, and shared by an aliasing copy. They are atomic so that concurrent
+     * readers do not race on them.
+     */
+    mutable RollingHash rolling;
+
+    static constexpr bool hashable = requires(const T& value) { std::hash<T>{}(value); };
+    static constexpr std::uint64_t hash_modulus = (std::uint64_t(1) << 61) - 1;
+
+    static constexpr std::uint64_t mul_mod(std::uint64_t a, std::uint64_t b) {
+        unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        std::uint64_t folded = (static_cast<std::uint64_t>(product) & hash_modulus) + static_cast<std::uint64_t>(product >> 61);
+        folded = (folded & hash_modulus) + (folded >> 61);
+        return folded >= hash_modulus ? folded - hash_modulus : folded;
+    }
+
+    static constexpr std::uint64_t add_mod(std::uint64_t a, std::uint64_t b) {
+        std::uint64_t sum = a + b;
+        return sum >= hash_modulus ? sum - hash_modulus : sum;
+    }
+
+    static constexpr std::uint64_t sub_mod(std::uint64_t a, std::uint64_t b) {
+        return a >= b ? a - b : a + hash_modulus - b;
+    }
+
+    static constexpr std::uint64_t pow_mod(std::uint64_t base, std::uint64_t exponent) {
+        std::uint64_t result = 1;
+        for (; exponent; exponent >>= 1, base = mul_mod(base, base)) {
+            if (exponent & 1) result = mul_mod(result, base);
+        }
+        return result;
+    }
+
+    static constexpr std::uint64_t hash_base = 0x0d6e8feb86659fd9 % hash_modulus;
+    static constexpr std::uint64_t hash_base_inverse = pow_mod(hash_base, hash_modulus - 2);
+
+    /**
+     * @brief Hashes one element with std::hash, scrambled so that small integers spread out.
+     */
+    static std::uint64_t element_hash(const T& value) {
+        std::uint64_t z = static_cast<std::uint64_t>(std::hash<T>{}(value)) + 0x9e3779b97f4a7c15;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return (z ^ (z >> 31)) % hash_modulus;
+    }
+
+    /**
+     * @brief Compares two elements with operator<=>, or derives a weak ordering from operator<.
+     */
+    static auto synth_three_way(const T& a, const T& b) {
+        if constexpr (std::three_way_comparable<T>) {
+            return a <=> b;
+        } else {
+            return a < b ? std::weak_ordering::less : b < a ? std::weak_ordering::greater : std::weak_ordering::equivalent;
+        }
+    }
+
+    /**
+     * @brief Marks the content hash for recomputation after the elements changed.
+     *
+     * An untracked hash is never valid, so the store is skipped for lists that do not track it.
+     */
+    void mark_hash_stale() const {
+        if (rolling.tracked) rolling.valid.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Checks if the content hash describes the current elements.
+     *
+     * A list sharing nodes with an aliasing copy never trusts its hash, since writes through the
+     * copy are not seen by the list.
+     */
+    bool hash_valid() const {
+        return rolling.valid.load(std::memory_order_relaxed) && !rolling.shared.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Computes the rolling hash of the elements in one pass.
+     * @param power Set to base^n.
+     * @return The hash.
+     */
+    std::uint64_t compute_hash(std::uint64_t& power) const {
+        std::uint64_t value = 0;
+        power = 1;
+        const Node* node = head.get();
+        for (std::size_t remaining = list_size; remaining != 0; --remaining, node = node->next.get()) {
+            value = add_mod(mul_mod(value, hash_base), element_hash(node->data));
+            power = mul_mod(power, hash_base);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Sets the content hash to that of an empty list.
+     */
+    void reset_hash() {
+        rolling.value = 0;
+        rolling.power = 1;
+        rolling.valid.store(rolling.tracked, std::memory_order_relaxed);
+        rolling.shared.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Allocates a node together with its reference count in a single allocation.
+     *
+     * The node is taken from the list's pool when reserve() has created one, and from the
+     * list's allocator otherwise.
+     *
+     * @param args The arguments forwarded to the constructor of T.
+     * @return Pointer to the new node.
+     */
+    template<typename... Args>
+    std::shared_ptr<Node> make_node(Args&&... args) {
+        if constexpr (poolable) {
+            if (pool) {
+                return std::allocate_shared<Node>(PoolAllocator<Node>(pool), std::in_place, std::forward<Args>(args)...);
+            }
+        }
+        return std::allocate_shared<Node>(alloc, std::in_place, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Whether reserve() pre-allocates nodes in a NodePool.
+     *
+     * A custom Allocator places the nodes itself (per thread, per NUMA node or on huge pages),
+     * and the pool would bypass it, so only lists using std::allocator are pooled.
+     */
+    static constexpr bool poolable = std::is_same_v<Allocator, std::allocator<T>>;
+
+#if defined(__GLIBCXX__)
+    /**
+     * @brief Size of a node allocated by std::allocate_shared with a PoolAllocator: the block libstdc++ rebinds it to.
+     */
+    static constexpr std::size_t pooled_node_size =
+        sizeof(std::_Sp_counted_ptr_inplace<Node, PoolAllocator<Node>, __gnu_cxx::__default_lock_policy>);
+#else
+    /**
+     * @brief Upper bound of the size of a node allocated by std::allocate_shared with a PoolAllocator.
+     */
+    static constexpr std::size_t pooled_node_size = sizeof(Node) + 2 * sizeof(void*) + sizeof(PoolAllocator<Node>) + alignof(Node);
+#endif
+
+    /**
+     * @brief Links a new node after the tail.
+     * @param newNode The node to append.
+     */
+    void link_back(std::shared_ptr<Node> newNode) {
+        Node* newNodePtr = newNode.get();
+        if constexpr (hashable) {
+            if (hash_valid()) {
+                rolling.value = add_mod(mul_mod(rolling.value, hash_base), element_hash(newNodePtr->data));
+                rolling.power = mul_mod(rolling.power, hash_base);
+            }
+        }
+        if (!head) {
+            head = std::move(newNode);
+        } else {
+            tail->next = std::move(newNode);
+        }
+        tail = newNodePtr;
+        ++list_size;
+    }
+
+    /**
+     * @brief Truncates the list to n elements in one pass, or grows it by calling append.
+     * @param n The new size.
+     * @param append Callable appending one element.
+     */
+    template<typename Append>
+    void resize_with(std::size_t n, Append append) {
+        if (n == 0) {
+            clear();
+        } else if (n < list_size) {
+            Node* last = head.get();
+            for (std::size_t i = 1; i < n; ++i) {
+                last = last->next.get();
+            }
+            std::shared_ptr<Node> rest = std::move(last->next);
+            tail = last;
+            list_size = n;
+            mark_hash_stale();
+            release_nodes(rest, std::numeric_limits<std::size_t>::max());
+        } else if (n > list_size) {
+            reserve(n);
+            while (list_size < n) append();
+        }
+    }
+
+    /**
+     * @brief Unlinks the first count nodes as a chain.
+     * @param count The number of nodes to unlink; must be between 1 and list_size.
+     * @return The detached chain and a pointer to its last node.
+     */
+    std::pair<std::shared_ptr<Node>, Node*> detach_front(std::size_t count) {
+        Node* last = head.get();
+        for (std::size_t i = 1; i < count; ++i) {
+            last = last->next.get();
+        }
+        std::shared_ptr<Node> prefix = std::move(head);
+        head = std::move(last->next);
+        if (!head) {
+            tail = nullptr;
+        }
+        list_size -= count;
+        mark_hash_stale();
+        return {std::move(prefix), last};
+    }
+
+    /**
+     * @brief Moves the node owned by link onto the front of a chain of removed nodes.
+     * @param link The link owning the node; receives the node's successor.
+     * @param removed The chain collecting removed nodes.
+     */
+    static void unlink_into(std::shared_ptr<Node>& link, std::shared_ptr<Node>& removed) {
+        std::shared_ptr<Node> node = std::move(link);
+        link = std::move(node->next);
+        node->next = std::move(removed);
+        removed = std::move(node);
+    }
+
+    /**
+     * @brief Frees up to budget nodes from the front of a detached chain.
+     *
+     * Nodes are unlinked one at a time so that freeing a long chain never recurses through the
+     * shared_ptr destructors. A node that is still shared with another list ends the walk, since
+     * that list keeps the rest of the chain alive.
+     *
+     * @param chain The chain to free; advanced past the freed nodes.
+     * @param budget The maximum number of nodes to free.
+     * @return True if the whole chain has been released.
+     */
+    static bool release_nodes(std::shared_ptr<Node>& chain, std::size_t budget) {
+        while (chain && budget > 0) {
+            if (chain.use_count() != 1) {
+                chain.reset();
+                break;
+            }
+            std::shared_ptr<Node> next = std::move(chain->next);
+            chain = std::move(next);
+            --budget;
+        }
+        return !chain;
+    }
+
+    /**
+     * @brief Merges two sorted chains by relinking their nodes.
+     *
+     * On ties the node from first goes first, so the merge is stable. If comp throws, out still
+     * owns every node of both chains, in no particular order.
+     *
+     * @param out Empty link that receives the merged chain.
+     * @param first The chain whose nodes go first among equal ones.
+     * @param second The other chain.
+     * @param comp The strict weak ordering.
+     */
+    template<typename Compare>
+    static void merge_chains(std::shared_ptr<Node>& out, std::shared_ptr<Node> first, std::shared_ptr<Node> second, Compare& comp) {
+        std::shared_ptr<Node>* link = &out;
+        try {
+            while (first && second) {
+                std::shared_ptr<Node>& taken = comp(second->data, first->data) ? second : first;
+                *link = std::move(taken);
+                taken = std::move((*link)->next);
+                link = &(*link)->next;
+            }
+        } catch (...) {
+            *link = std::move(first);
+            while (*link) link = &(*link)->next;
+            *link = std::move(second);
+            throw;
+        }
+        *link = first ? std::move(first) : std::move(second);
+    }
+
+    /**
+     * @brief Maps a key to an unsigned integer with the same ordering, for radix_sort().
+     *
+     * Signed integers have their sign bit flipped. Floating-point keys are reinterpreted as
+     * their bits, with every bit of negative values flipped and the sign bit of the others, so
+     * that -0.0 sorts before +0.0 and NaNs sort past the infinities of their sign.
+     *
+     * @param key The key.
+     * @return The order-preserving unsigned key.
+     */
+    template<typename K>
+    static auto radix_key(K key) {
+        static_assert(std::is_integral_v<K> || std::is_floating_point_v<K>, "radix_sort keys must be integers or floating point.");
+        if constexpr (std::is_same_v<K, bool>) {
+            return static_cast<std::uint8_t>(key);
+        } else if constexpr (std::is_integral_v<K>) {
+            using U = std::make_unsigned_t<K>;
+            U bits = static_cast<U>(key);
+            if constexpr (std::is_signed_v<K>) bits ^= U(1) << (8 * sizeof(U) - 1);
+            return bits;
+        } else {
+            using U = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+            static_assert(sizeof(K) == sizeof(U), "radix_sort supports float and double keys.");
+            U bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            constexpr U sign = U(1) << (8 * sizeof(U) - 1);
+            return (bits & sign) ? U(~bits) : U(bits | sign);
+        }
+    }
+
+    /**
+     * @brief A chain of nodes being assembled by relinking, with its length and end link.
+     */
+    struct Chain {
+        std::shared_ptr<Node> head; //!< The first node of the chain.
+        std::shared_ptr<Node>* link = &head; //!< The empty link past the last node.
+        Node* last = nullptr; //!< The last node of the chain.
+        std::size_t length = 0; //!< Number of nodes in the chain.
+
+        Chain() = default;
+        Chain(const Chain&) = delete;
+        Chain& operator=(const Chain&) = delete;
+
+        /**
+         * @brief Moves the first node of a chain onto the end of this one.
+         * @param source The link owning the node; receives the node's successor.
+         */
+        void take_from(std::shared_ptr<Node>& source) {
+            *link = std::move(source);
+            last = link->get();
+            source = std::move(last->next);
+            link = &last->next;
+            ++length;
+        }
+
+        /**
+         * @brief Moves every node of another chain onto the end of this one.
+         * @param other The chain to empty.
+         */
+        void append(Chain& other) {
+            if (!other.head) return;
+            *link = std::move(other.head);
+            link = other.link;
+            last = other.last;
+            length += other.length;
+            other.reset();
+        }
+
+        /**
+         * @brief Moves a chain of unknown length onto the end of this one.
+         * @param chain The chain to empty.
+         */
+        void append(std::shared_ptr<Node>& chain) {
+            *link = std::move(chain);
+            while (*link) {
+                last = link->get();
+                link = &last->next;
+                ++length;
+            }
+        }
+
+        /**
+         * @brief Forgets the chain after its head has been moved away.
+         */
+        void reset() {
+            link = &head;
+            last = nullptr;
+            length = 0;
+        }
+    };
+
+    /**
+     * @brief Makes a list own an assembled chain.
+     * @param list The list, which must be empty.
+     * @param chain The chain to hand over.
+     */
+    static void adopt(SinglyLinkedList& list, Chain& chain) {
+        list.head = std::move(chain.head);
+        list.tail = chain.last;
+        list.list_size = chain.length;
+        list.mark_hash_stale();
+        chain.reset();
+    }
+
+    /**
+     * @brief The set operations, by which of the three kinds of merge steps keep an element.
+     */
+    enum class SetOperation {
+        Union, //!< Keeps elements only in a, elements only in b, and a's copy of common elements.
+        Intersection, //!< Keeps a's copy of common elements.
+        Difference //!< Keeps elements only in a.
+    };
+
+    /**
+     * @brief Runs a set operation on two sorted lists, copying the kept elements into a new list.
+     */
+    template<typename Compare>
+    static SinglyLinkedList copy_set_operation(const SinglyLinkedList& a, const SinglyLinkedList& b, SetOperation operation, Compare& comp) {
+        SinglyLinkedList result(a.alloc);
+        Node* x = a.head.get();
+        Node* y = b.head.get();
+        while (x && y) {
+            if (comp(x->data, y->data)) {
+                if (operation != SetOperation::Intersection) result.push_back(x->data);
+                x = x->next.get();
+            } else if (comp(y->data, x->data)) {
+                if (operation == SetOperation::Union) result.push_back(y->data);
+                y = y->next.get();
+            } else {
+                if (operation != SetOperation::Difference) result.push_back(x->data);
+                x = x->next.get();
+                y = y->next.get();
+            }
+        }
+        if (operation != SetOperation::Intersection) {
+            for (; x; x = x->next.get()) result.push_back(x->data);
+        }
+        if (operation == SetOperation::Union) {
+            for (; y; y = y->next.get()) result.push_back(y->data);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Runs a set operation on two sorted lists by relinking their nodes into a new list.
+     *
+     * Nodes that are not kept are freed. If comp throws, a keeps every node taken so far
+     * followed by its unvisited nodes, and b keeps every other node.
+     */
+    template<typename Compare>
+    static SinglyLinkedList relink_set_operation(SinglyLinkedList& a, SinglyLinkedList& b, SetOperation operation, Compare& comp) {
+        SinglyLinkedList result(a.alloc);
+        result.pool = a.pool;
+        Chain kept, dropped;
+        std::shared_ptr<Node> x = std::move(a.head);
+        std::shared_ptr<Node> y = std::move(b.head);
+        a.tail = b.tail = nullptr;
+        a.list_size = b.list_size = 0;
+        a.mark_hash_stale();
+        b.mark_hash_stale();
+        try {
+            while (x && y) {
+                if (comp(x->data, y->data)) {
+                    (operation != SetOperation::Intersection ? kept : dropped).take_from(x);
+                } else if (comp(y->data, x->data)) {
+                    (operation == SetOperation::Union ? kept : dropped).take_from(y);
+                } else {
+                    (operation != SetOperation::Difference ? kept : dropped).take_from(x);
+                    dropped.take_from(y);
+                }
+            }
+        } catch (...) {
+            kept.append(x);
+            adopt(a, kept);
+            dropped.append(y);
+            adopt(b, dropped);
+            throw;
+        }
+        if (operation != SetOperation::Intersection) kept.append(x);
+        if (operation == SetOperation::Union) kept.append(y);
+        adopt(result, kept);
+        release_nodes(dropped.head, std::numeric_limits<std::size_t>::max());
+        release_nodes(x, std::numeric_limits<std::size_t>::max());
+        release_nodes(y, std::numeric_limits<std::size_t>::max());
+        return result;
+    }
+
+    /**
+     * @brief Moves every node of another list onto the end of a list in O(1).
+     * @param into The list to extend.
+     * @param from The list to empty.
+     */
+    static void append_nodes(SinglyLinkedList& into, SinglyLinkedList& from) {
+        if (!from.head) return;
+        if (into.tail) {
+            into.tail->next = std::move(from.head);
+        } else {
+            into.head = std::move(from.head);
+        }
+        into.tail = from.tail;
+        into.list_size += from.list_size;
+        from.tail = nullptr;
+        from.list_size = 0;
+        into.mark_hash_stale();
+        from.mark_hash_stale();
+    }
+
+    /**
+     * @brief Merges sorted lists into one by relinking, using a loser tree over the list heads.
+     *
+     * Every list is left empty. On ties the list that comes first wins, so the merge is
+     * stable. If comp throws, the nodes merged so far are moved to the front of the first
+     * list and every other node stays in its list.
+     */
+    template<typename Compare>
+    static SinglyLinkedList loser_tree_merge(std::span<SinglyLinkedList> lists, Compare& comp) {
+        SinglyLinkedList result;
+        if (lists.empty()) return result;
+        result.alloc = lists.front().alloc;
+        result.pool = lists.front().pool;
+        const std::size_t k = lists.size();
+        for (SinglyLinkedList& list : lists) list.mark_hash_stale();
+        // Whether source a's head comes before source b's; exhausted sources lose every match.
+        auto before = [&lists, &comp](std::size_t a, std::size_t b) {
+            if (!lists[a].head) return false;
+            if (!lists[b].head) return true;
+            if (comp(lists[a].head->data, lists[b].head->data)) return true;
+            if (comp(lists[b].head->data, lists[a].head->data)) return false;
+            return a < b;
+        };
+        Chain merged;
+        try {
+            // tree[0] holds the winner; tree[n] for n in [1, k) holds the loser of the match at
+            // internal node n, whose children are nodes 2n and 2n + 1, and leaf i is node k + i.
+            std::vector<std::size_t> tree(k);
+            std::vector<std::size_t> winners(2 * k);
+            for (std::size_t i = 0; i < k; ++i) winners[k + i] = i;
+            for (std::size_t n = k - 1; n >= 1; --n) {
+                std::size_t left = winners[2 * n], right = winners[2 * n + 1];
+                bool leftWins = before(left, right);
+                winners[n] = leftWins ? left : right;
+                tree[n] = leftWins ? right : left;
+            }
+            tree[0] = k == 1 ? 0 : winners[1];
+            while (lists[tree[0]].head) {
+                std::size_t winner = tree[0];
+                SinglyLinkedList& source = lists[winner];
+                merged.take_from(source.head);
+                if (--source.list_size == 0) source.tail = nullptr;
+                for (std::size_t n = (winner + k) / 2; n >= 1; n /= 2) {
+                    if (before(tree[n], winner)) std::swap(tree[n], winner);
+                }
+                tree[0] = winner;
+            }
+        } catch (...) {
+            SinglyLinkedList& first = lists.front();
+            merged.append(first.head);
+            adopt(first, merged);
+            throw;
+        }
+        adopt(result, merged);
+        return result;
+    }
+
+    /**
+     * @brief Points tail at the last node after the chain has been relinked.
+     */
+    void relink_tail() {
+        mark_hash_stale();
+        tail = nullptr;
+        for (Node* node = head.get(); node; node = node->next.get()) {
+            tail = node;
+        }
+    }
+
+    /**
+     * @brief Reclamation task that frees a detached chain on the AsyncReclaimer thread.
+     */
+    struct ChainReclaimTask : AsyncReclaimer::Task {
+        std::shared_ptr<Node> chain; //!< The detached nodes still to be freed.
+        std::promise<void> done; //!< Fulfilled once the chain is freed.
+
+        explicit ChainReclaimTask(std::shared_ptr<Node> nodes) : chain(std::move(nodes)) {}
+
+        bool reclaim(std::size_t budget) override {
+            if (!release_nodes(chain, budget)) return false;
+            done.set_value();
+            return true;
+        }
+    };
 
 public:
     using value_type = T;
     using reference = T&;
     using const_reference = const T&;
     using size_type = std::size_t;
+    using allocator_type = Allocator;
+
+    class Iterator;
+    class ConstIterator;
+
+    /**
+     * @brief A positional edit for apply_edits().
+     *
+     * Indices refer to positions in the list before any edit of the batch is applied.
+     */
+    struct Edit {
+        /**
+         * @brief The kind of change an Edit makes.
+         */
+        enum class Kind { Insert, Erase, Replace };
+
+        Kind kind; //!< The kind of change.
+        std::size_t index; //!< The position the edit applies to.
+        std::optional<T> value; //!< The value inserted or written; empty for Erase.
+
+        /**
+         * @brief Creates an edit inserting a value before the element at index.
+         * @param index The position to insert at; may equal the list size to append.
+         * @param value The value to insert.
+         * @return The Edit.
+         */
+        static Edit insert(std::size_t index, T value) { return Edit{Kind::Insert, index, std::move(value)}; }
+
+        /**
+         * @brief Creates an edit erasing the element at index.
+         * @param index The position to erase.
+         * @return The Edit.
+         */
+        static Edit erase(std::size_t index) { return Edit{Kind::Erase, index, std::nullopt}; }
+
+        /**
+         * @brief Creates an edit overwriting the element at index.
+         * @param index The position to overwrite.
+         * @param value The new value.
+         * @return The Edit.
+         */
+        static Edit replace(std::size_t index, T value) { return Edit{Kind::Replace, index, std::move(value)}; }
+    };
 
     /**
      * @brief Default constructor for SinglyLinkedList.
      */
     SinglyLinkedList() : head(nullptr), tail(nullptr), list_size(0) {}
 
+    /**
+     * @brief Constructs an empty SinglyLinkedList using the given node allocator.
+     * @param allocator The allocator for the nodes.
+     */
+    explicit SinglyLinkedList(const Allocator& allocator) : head(nullptr), tail(nullptr), list_size(0), alloc(allocator) {}
+
     /**
      * @brief Constructs a SinglyLinkedList from a range of iterators.
      * @param first The start iterator of the range.
@@ -102,6 +775,17 @@ public:
         std::for_each(first, last, [this](const T& value) { push_back(value); });
     }
 
+#if defined(__cpp_lib_containers_ranges)
+    /**
+     * @brief Constructs a SinglyLinkedList from a range, as std::ranges::to does.
+     * @param range The range whose elements are copied.
+     */
+    template<std::ranges::input_range R>
+    SinglyLinkedList(std::from_range_t, R&& range) : head(nullptr), tail(nullptr), list_size(0) {
+        for (auto&& value : range) push_back(std::forward<decltype(value)>(value));
+    }
+#endif
+
     /**
      * @brief Constructs a SinglyLinkedList from an initializer list.
      * @param initList The initializer list.
@@ -111,13 +795,15 @@ public:
     /**
      * @brief Destructor for SinglyLinkedList.
      */
-    ~SinglyLinkedList() = default;
+    ~SinglyLinkedList() {
+        clear();
+    }
 
     /**
      * @brief Check if the SinglyLinkedList is empty.
      * @return True if the SinglyLinkedList is empty, false if not.
      */
-    bool empty() {
+    bool empty() const {
         return !this->head;
     }
 
@@ -125,7 +811,7 @@ public:
      * @brief Copy constructor for SinglyLinkedList.
      * @param other The SinglyLinkedList to copy.
      */
-    SinglyLinkedList(const SinglyLinkedList& other) : head(nullptr), tail(nullptr), list_size(0) {
+    SinglyLinkedList(const SinglyLinkedList& other) : head(nullptr), tail(nullptr), list_size(0), alloc(other.alloc) {
         if (this != &other) {
             clear();
             Node* current = other.head.get();
@@ -143,43 +829,102 @@ public:
      */
     SinglyLinkedList& operator=(const SinglyLinkedList& other) {
         if (this == &other) {return *this;}
+        std::shared_ptr<Node> old = std::move(this->head);
         this->head = other.head;
         this->tail = other.tail;
         this->list_size = other.list_size;
+        mark_hash_stale();
+        rolling.shared.store(true, std::memory_order_relaxed);
+        other.rolling.shared.store(true, std::memory_order_relaxed);
+        release_nodes(old, std::numeric_limits<std::size_t>::max());
+        return *this;
+    }
+
+    /**
+     * @brief Move constructor for SinglyLinkedList.
+     * @param other The SinglyLinkedList to move from; left empty.
+     */
+    SinglyLinkedList(SinglyLinkedList&& other) noexcept
+        : head(std::move(other.head)), tail(other.tail), list_size(other.list_size), pool(std::move(other.pool)), alloc(other.alloc),
+          rolling(other.rolling) {
+        other.tail = nullptr;
+        other.list_size = 0;
+        other.mark_hash_stale();
+    }
+
+    /**
+     * @brief Move assignment operator for SinglyLinkedList.
+     * @param other The SinglyLinkedList to move from; left empty.
+     * @return Reference to this SinglyLinkedList.
+     */
+    SinglyLinkedList& operator=(SinglyLinkedList&& other) noexcept {
+        if (this == &other) {return *this;}
+        clear();
+        swap(*this, other);
         return *this;
     }
 
+    /**
+     * @brief Gets the allocator used for the nodes.
+     * @return A copy of the allocator.
+     */
+    Allocator get_allocator() const { return alloc; }
+
     /**
      * @brief Adds a new element to the end of the list.
      * @param val The value to add.
      */
-    void push_back(const T val) {
-        auto newNode = std::make_unique<Node>(std::move(val));
-        Node* newNodePtr = newNode.get();
-        if (!head) {
-            head = std::move(newNode);
-            tail = newNodePtr;
-        } else {
-            tail->next = std::move(newNode);
-            tail = newNodePtr;
-        }
-        ++list_size;
+    void push_back(const T& val) {
+        link_back(make_node(val));
+    }
+
+    /**
+     * @brief Adds a new element to the end of the list, moving from the given value.
+     * @param val The value to add.
+     */
+    void push_back(T&& val) {
+        link_back(make_node(std::move(val)));
+    }
+
+    /**
+     * @brief Constructs a new element in place at the end of the list.
+     * @param args The arguments forwarded to the constructor of T.
+     * @return A reference to the new element.
+     */
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        link_back(make_node(std::forward<Args>(args)...));
+        return tail->data;
     }
 
     /**
      * @brief Adds a new element to the end of the list.
      * @param val The value to add.
      */
-    void push(const T val) {
+    void push(const T& val) {
         push_back(val);
     }
 
+    /**
+     * @brief Adds a new element to the end of the list, moving from the given value.
+     * @param val The value to add.
+     */
+    void push(T&& val) {
+        push_back(std::move(val));
+    }
+
     /**
      * @brief Adds a new element to the front of the list.
      * @param val The value to add.
      */
     void push_front(T val) {
-        auto newNode = std::make_unique<Node>(std::move(val));
+        auto newNode = make_node(std::move(val));
+        if constexpr (hashable) {
+            if (hash_valid()) {
+                rolling.value = add_mod(rolling.value, mul_mod(element_hash(newNode->data), rolling.power));
+                rolling.power = mul_mod(rolling.power, hash_base);
+            }
+        }
         if (!head) {
             head = std::move(newNode);
             tail = head.get();
@@ -198,6 +943,12 @@ public:
         if (!head) {
             throw std::runtime_error("List is empty: cannot pop back.");
         }
+        if constexpr (hashable) {
+            if (hash_valid()) {
+                rolling.value = mul_mod(sub_mod(rolling.value, element_hash(tail->data)), hash_base_inverse);
+                rolling.power = mul_mod(rolling.power, hash_base_inverse);
+            }
+        }
 
         if (head.get() == tail) {
             head.reset();
@@ -214,26 +965,91 @@ public:
     }
 
     /**
-     * @brief Removes the first element of the list.
-     * @throws std::runtime_error if the list is empty.
+     * @brief Removes the first element of the list.
+     * @throws std::runtime_error if the list is empty.
+     */
+    void pop_front() {
+        if (!head) {
+            throw std::runtime_error("List is empty: cannot pop front.");
+        }
+        if constexpr (hashable) {
+            if (hash_valid()) {
+                rolling.power = mul_mod(rolling.power, hash_base_inverse);
+                rolling.value = sub_mod(rolling.value, mul_mod(element_hash(head->data), rolling.power));
+            }
+        }
+        head = std::move(head->next);
+        if (!head) {
+            tail = nullptr;
+        }
+        --list_size;
+    }
+
+    /**
+     * @brief Removes the first element of the list.
+     * @throws std::runtime_error if the list is empty.
+     */
+    void pop() {
+        pop_front();
+    }
+
+    /**
+     * @brief Removes up to n elements from the front, moving them to an output iterator.
+     *
+     * The popped nodes are unlinked as one chain and freed together after the elements have
+     * been moved out.
+     *
+     * @param n The maximum number of elements to pop.
+     * @param out The output iterator receiving the elements in list order.
+     * @return The output iterator past the last element written.
+     */
+    template<typename OutputIt>
+    OutputIt pop_front_n(std::size_t n, OutputIt out) {
+        std::size_t count = std::min(n, list_size);
+        if (count == 0) return out;
+        std::shared_ptr<Node> prefix = detach_front(count).first;
+        for (Node* node = prefix.get(); node != nullptr; node = node->next.get()) {
+            *out = std::move(node->data);
+            ++out;
+        }
+        release_nodes(prefix, std::numeric_limits<std::size_t>::max());
+        return out;
+    }
+
+    /**
+     * @brief Moves every element to the end of a std::vector and clears the list.
+     * @param vec The std::vector receiving the elements.
+     * @return The number of elements moved.
+     */
+    std::size_t drain_into(std::vector<T>& vec) {
+        std::size_t count = list_size;
+        vec.reserve(vec.size() + count);
+        pop_front_n(count, std::back_inserter(vec));
+        return count;
+    }
+
+    /**
+     * @brief Detaches up to n elements from the front as a new list, without copying or moving elements.
+     * @param n The maximum number of elements to detach.
+     * @return A SinglyLinkedList owning the detached nodes.
      */
-    void pop_front() {
-        if (!head) {
-            throw std::runtime_error("List is empty: cannot pop front.");
-        }
-        head = std::move(head->next);
-        if (!head) {
-            tail = nullptr;
-        }
-        --list_size;
+    SinglyLinkedList take_front(std::size_t n) {
+        SinglyLinkedList prefix(alloc);
+        std::size_t count = std::min(n, list_size);
+        if (count == 0) return prefix;
+        auto detached = detach_front(count);
+        prefix.head = std::move(detached.first);
+        prefix.tail = detached.second;
+        prefix.list_size = count;
+        return prefix;
     }
 
     /**
-     * @brief Removes the first element of the list.
-     * @throws std::runtime_error if the list is empty.
+     * @brief Moves every node of another list onto the end of this one in O(1), without copying or moving elements.
+     * @param other The list to empty; it must not be this list.
      */
-    void pop() {
-        pop_front();
+    void splice_back(SinglyLinkedList& other) {
+        if (&other != this) append_nodes(*this, other);
     }
 
     /**
@@ -247,18 +1063,17 @@ public:
             push_front(std::move(val));
             return;
         }
-        Node* prev = nullptr;
         Node* current = head.get();
         while (current && current->next.get() != pos) {
-            prev = current;
             current = current->next.get();
         }
         if (!current) {
             throw std::runtime_error("Position not found.");
         }
-        auto newNode = std::make_unique<Node>(std::move(val));
+        auto newNode = make_node(std::move(val));
         newNode->next = std::move(current->next);
         current->next = std::move(newNode);
+        mark_hash_stale();
         if (current->next.get() == tail) {
             tail = current->next.get();
         }
@@ -284,6 +1099,7 @@ public:
             }
         }
         if (prev) {
+            mark_hash_stale();
             prev->next = std::move(current->next);
             if (!prev->next) {
                 tail = prev;
@@ -292,17 +1108,332 @@ public:
         }
     }
 
+    /**
+     * @brief Inserts a new element after the given position in O(1).
+     * @param pos Iterator to the element after which to insert.
+     * @param val The value to insert.
+     * @return An Iterator to the inserted element.
+     * @throws std::runtime_error if pos is the end iterator.
+     */
+    Iterator insert_after(Iterator pos, T val) {
+        if (!pos.current) {
+            throw std::runtime_error("Cannot insert after the end of the list.");
+        }
+        auto newNode = make_node(std::move(val));
+        newNode->next = std::move(pos.current->next);
+        pos.current->next = std::move(newNode);
+        mark_hash_stale();
+        if (pos.current == tail) {
+            tail = pos.current->next.get();
+        }
+        ++list_size;
+        return Iterator(pos.current->next.get());
+    }
+
+    /**
+     * @brief Erases the element after the given position in O(1).
+     * @param pos Iterator to the element before the one to erase.
+     * @return An Iterator to the element following the erased one.
+     * @throws std::runtime_error if there is no element after pos.
+     */
+    Iterator erase_after(Iterator pos) {
+        if (!pos.current || !pos.current->next) {
+            throw std::runtime_error("No element after the position to erase.");
+        }
+        Iterator last(pos.current->next->next.get());
+        erase_after(pos, last);
+        return last;
+    }
+
+    /**
+     * @brief Erases the elements strictly between two positions in a single pass.
+     * @param first Iterator to the element before the first one to erase.
+     * @param last Iterator to the element after the last one to erase, or end().
+     * @return The number of erased elements.
+     * @throws std::runtime_error if first is the end iterator.
+     */
+    std::size_t erase_after(Iterator first, Iterator last) {
+        if (!first.current) {
+            throw std::runtime_error("Cannot erase after the end of the list.");
+        }
+        std::size_t count = 0;
+        for (Node* node = first.current->next.get(); node != last.current; node = node->next.get()) {
+            ++count;
+        }
+        if (count == 0) return 0;
+        mark_hash_stale();
+        std::shared_ptr<Node> removed = std::move(first.current->next);
+        Node* removedTail = removed.get();
+        for (std::size_t i = 1; i < count; ++i) {
+            removedTail = removedTail->next.get();
+        }
+        first.current->next = std::move(removedTail->next);
+        if (!last.current) {
+            tail = first.current;
+        }
+        list_size -= count;
+        release_nodes(removed, std::numeric_limits<std::size_t>::max());
+        return count;
+    }
+
+    /**
+     * @brief Applies a batch of positional edits in a single traversal.
+     *
+     * The edits are sorted by position, so replaying k edits costs O(n + k log k) instead of one
+     * O(n) walk per edit. Several inserts at the same index are applied in batch order, before
+     * the original element at that index. The whole batch is validated before the list is
+     * changed, and the inserted and replacing values are moved out of the edits.
+     *
+     * @param edits The edits to apply.
+     * @throws std::out_of_range if an edit refers to a position past the end of the list.
+     * @throws std::runtime_error if two Erase or Replace edits target the same index.
+     */
+    void apply_edits(std::span<Edit> edits) {
+        std::vector<std::size_t> order(edits.size());
+        for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&edits](std::size_t a, std::size_t b) {
+            const Edit& x = edits[a];
+            const Edit& y = edits[b];
+            if (x.index != y.index) return x.index < y.index;
+            return x.kind == Edit::Kind::Insert && y.kind != Edit::Kind::Insert;
+        });
+        std::size_t lastTouched = std::numeric_limits<std::size_t>::max();
+        for (std::size_t i : order) {
+            const Edit& edit = edits[i];
+            if (edit.kind == Edit::Kind::Insert) {
+                if (edit.index > list_size) throw std::out_of_range("Edit index out of range");
+                if (!edit.value) throw std::runtime_error("Insert edit has no value.");
+                continue;
+            }
+            if (edit.index >= list_size) throw std::out_of_range("Edit index out of range");
+            if (edit.kind == Edit::Kind::Replace && !edit.value) throw std::runtime_error("Replace edit has no value.");
+            if (edit.index == lastTouched) throw std::runtime_error("Conflicting edits at the same index.");
+            lastTouched = edit.index;
+        }
+
+        std::shared_ptr<Node> removed;
+        std::shared_ptr<Node>* link = &head;
+        Node* prev = nullptr;
+        std::size_t pos = 0;
+        mark_hash_stale();
+        for (std::size_t i : order) {
+            Edit& edit = edits[i];
+            while (pos < edit.index) {
+                prev = link->get();
+                link = &prev->next;
+                ++pos;
+            }
+            switch (edit.kind) {
+                case Edit::Kind::Insert: {
+                    auto newNode = make_node(std::move(*edit.value));
+                    newNode->next = std::move(*link);
+                    *link = std::move(newNode);
+                    prev = link->get();
+                    link = &prev->next;
+                    if (!*link) tail = prev;
+                    ++list_size;
+                    break;
+                }
+                case Edit::Kind::Erase:
+                    unlink_into(*link, removed);
+                    if (!*link) tail = prev;
+                    ++pos;
+                    --list_size;
+                    break;
+                case Edit::Kind::Replace:
+                    (*link)->data = std::move(*edit.value);
+                    break;
+            }
+        }
+        release_nodes(removed, std::numeric_limits<std::size_t>::max());
+    }
+
+    /**
+     * @brief Removes every element satisfying a predicate in a single pass.
+     *
+     * Removed nodes are collected and freed together once the traversal is done, so the
+     * predicate never observes a half-destroyed element. If the predicate throws, the elements
+     * removed so far stay removed.
+     *
+     * @param pred The predicate deciding which elements to remove.
+     * @return The number of removed elements.
+     */
+    template<typename Pred>
+    std::size_t remove_if(Pred pred) {
+        std::shared_ptr<Node> removed;
+        std::size_t count = 0;
+        std::shared_ptr<Node>* link = &head;
+        Node* lastKept = nullptr;
+        mark_hash_stale();
+        try {
+            while (*link) {
+                if (pred((*link)->data)) {
+                    unlink_into(*link, removed);
+                    ++count;
+                } else {
+                    lastKept = link->get();
+                    link = &lastKept->next;
+                }
+            }
+            tail = lastKept;
+        } catch (...) {
+            list_size -= count;
+            release_nodes(removed, std::numeric_limits<std::size_t>::max());
+            throw;
+        }
+        list_size -= count;
+        release_nodes(removed, std::numeric_limits<std::size_t>::max());
+        return count;
+    }
+
+    /**
+     * @brief Removes every element equal to a value in a single pass.
+     * @param val The value to remove; may refer to an element of this list.
+     * @return The number of removed elements.
+     */
+    std::size_t remove(const T& val) {
+        return remove_if([&val](const T& item) { return item == val; });
+    }
+
+    /**
+     * @brief Removes consecutive duplicate elements in a single pass.
+     * @return The number of removed elements.
+     */
+    std::size_t unique() {
+        return unique([](const T& a, const T& b) { return a == b; });
+    }
+
+    /**
+     * @brief Removes every element for which a predicate holds together with the last kept element.
+     * @param pred Binary predicate called as pred(kept, candidate).
+     * @return The number of removed elements.
+     */
+    template<typename BinaryPred>
+    std::size_t unique(BinaryPred pred) {
+        if (!head) return 0;
+        std::shared_ptr<Node> removed;
+        std::size_t count = 0;
+        Node* kept = head.get();
+        mark_hash_stale();
+        try {
+            while (kept->next) {
+                if (pred(kept->data, kept->next->data)) {
+                    unlink_into(kept->next, removed);
+                    ++count;
+                } else {
+                    kept = kept->next.get();
+                }
+            }
+            tail = kept;
+        } catch (...) {
+            list_size -= count;
+            release_nodes(removed, std::numeric_limits<std::size_t>::max());
+            throw;
+        }
+        list_size -= count;
+        release_nodes(removed, std::numeric_limits<std::size_t>::max());
+        return count;
+    }
+
+    /**
+     * @brief Sorts the list in ascending order.
+     */
+    void sort() {
+        sort(std::less<>());
+    }
+
+    /**
+     * @brief Sorts the list by relinking its nodes, without copying or allocating.
+     *
+     * A bottom-up merge sort: each node is merged into a ladder of sorted chains whose lengths
+     * are powers of two, and the ladder is merged at the end. The sort is stable and takes
+     * O(n log n) comparisons. If comp throws, every element is kept, in an unspecified order.
+     *
+     * @param comp The strict weak ordering.
+     */
+    template<typename Compare>
+    void sort(Compare comp) {
+        if (list_size < 2) return;
+        std::shared_ptr<Node> ladder[64];
+        std::size_t rungs = 0;
+        std::shared_ptr<Node> carry;
+        try {
+            while (head) {
+                carry = std::move(head);
+                head = std::move(carry->next);
+                std::size_t i = 0;
+                for (; i < rungs && ladder[i]; ++i) {
+                    std::shared_ptr<Node> later = std::move(carry);
+                    merge_chains(carry, std::move(ladder[i]), std::move(later), comp);
+                }
+                if (i == rungs) ++rungs;
+                ladder[i] = std::move(carry);
+            }
+            for (std::size_t i = 0; i < rungs; ++i) {
+                std::shared_ptr<Node> later = std::move(carry);
+                merge_chains(carry, std::move(ladder[i]), std::move(later), comp);
+            }
+            head = std::move(carry);
+        } catch (...) {
+            std::shared_ptr<Node> rest = std::move(head);
+            std::shared_ptr<Node>* link = &head;
+            auto append = [&link](std::shared_ptr<Node>& chain) {
+                *link = std::move(chain);
+                while (*link) link = &(*link)->next;
+            };
+            append(carry);
+            for (std::size_t i = 0; i < rungs; ++i) append(ladder[i]);
+            append(rest);
+            relink_tail();
+            throw;
+        }
+        relink_tail();
+    }
+
     /**
      * @brief Clears the list.
      */
     void clear() {
-        head.reset();
+        release_nodes(head, std::numeric_limits<std::size_t>::max());
         tail = nullptr;
         list_size = 0;
+        reset_hash();
+    }
+
+    /**
+     * @brief Clears the list in O(1) and frees its nodes on the background reclaimer thread.
+     *
+     * Element destructors run on the AsyncReclaimer thread, so they must not depend on the
+     * calling thread.
+     */
+    void clear_async() {
+        release_async();
+    }
+
+    /**
+     * @brief Clears the list in O(1) and frees its nodes on the background reclaimer thread.
+     * @return A future that becomes ready once every detached node has been freed.
+     */
+    std::future<void> release_async() {
+        if (!head) {
+            std::promise<void> ready;
+            ready.set_value();
+            return ready.get_future();
+        }
+        auto task = std::make_unique<ChainReclaimTask>(std::move(head));
+        std::future<void> done = task->done.get_future();
+        tail = nullptr;
+        list_size = 0;
+        reset_hash();
+        AsyncReclaimer::instance().submit(std::move(task));
+        return done;
     }
 
     /**
      * @brief Retrieves the data at the head of the list.
+     *
+     * The reference allows writing the element, so the content hash is marked stale.
+     *
      * @return A reference to the data at the head.
      * @throws std::runtime_error if the list is empty.
      */
@@ -310,11 +1441,15 @@ public:
         if (!head) {
             throw std::runtime_error("List is empty: cannot access head.");
         }
+        mark_hash_stale();
         return head->data;
     }
 
     /**
      * @brief Retrieves the data at the tail of the list.
+     *
+     * The reference allows writing the element, so the content hash is marked stale.
+     *
      * @return A reference to the data at the tail.
      * @throws std::runtime_error if the list is empty.
      */
@@ -322,6 +1457,7 @@ public:
         if (!tail) {
             throw std::runtime_error("List is empty: cannot access tail.");
         }
+        mark_hash_stale();
         return tail->data;
     }
 
@@ -343,6 +1479,7 @@ public:
             current = current->next.get();
             ++i;
         }
+        mark_hash_stale();
         return current->data;
     }
 
@@ -352,6 +1489,54 @@ public:
      */
     std::size_t size() const { return list_size; }
 
+    /**
+     * @brief Gets the number of elements the list can hold without allocating.
+     * @return The size plus the number of pre-allocated free nodes.
+     */
+    std::size_t capacity() const { return list_size + (pool ? pool->free_count() : 0); }
+
+    /**
+     * @brief Pre-allocates nodes so that the list can grow to n elements without allocating.
+     *
+     * The missing nodes are allocated as one slab and kept on a per-list free chain, which also
+     * takes back the nodes of this list's later pops and erases. Lists with a custom Allocator
+     * leave the allocation to it, and reserve() does nothing.
+     *
+     * @param n The number of elements to make room for.
+     */
+    void reserve(std::size_t n) {
+        if constexpr (!poolable) return;
+        if (n <= capacity()) return;
+        if (!pool) {
+            pool = std::make_shared<NodePool>(pooled_node_size);
+        }
+        pool->reserve(n - list_size);
+    }
+
+    /**
+     * @brief Releases pre-allocated nodes that are not in use.
+     */
+    void shrink_to_fit() {
+        if (pool) pool->shrink_to_fit();
+    }
+
+    /**
+     * @brief Resizes the list to n elements, appending value-initialized elements if it grows.
+     * @param n The new size.
+     */
+    void resize(std::size_t n) {
+        resize_with(n, [this] { emplace_back(); });
+    }
+
+    /**
+     * @brief Resizes the list to n elements, appending copies of a value if it grows.
+     * @param n The new size.
+     * @param val The value to append.
+     */
+    void resize(std::size_t n, const T& val) {
+        resize_with(n, [this, &val] { push_back(val); });
+    }
+
     /**
      * @brief Swaps the contents of two SinglyLinkedLists.
      * @param first The first list.
@@ -362,31 +1547,646 @@ public:
         swap(first.head, second.head);
         swap(first.tail, second.tail);
         swap(first.list_size, second.list_size);
+        swap(first.pool, second.pool);
+        swap(first.alloc, second.alloc);
+        swap(first.rolling, second.rolling);
+    }
+
+    /**
+     * @brief Sorts a list by an integer or floating-point key with an LSD radix sort.
+     *
+     * One traversal detaches the nodes and records each key with the node's position. The
+     * (key, position) records are then distributed over 256 buckets per key byte, skipping
+     * bytes on which all keys agree. A last pass relinks the nodes in sorted order. Elements
+     * are never moved or copied. Sorting records rather than chasing next pointers on every
+     * pass costs about 48 bytes of scratch memory per node, but a pass over a scrambled list
+     * costs one cache miss per node. The sort is stable and calls key_fn once per element.
+     * If key_fn throws, the list is left unchanged.
+     *
+     * @param list The list to sort.
+     * @param key_fn Callable returning the key of an element; integral, float or double.
+     */
+    template<typename KeyFn>
+    friend void radix_sort(SinglyLinkedList& list, KeyFn key_fn) {
+        if (list.list_size < 2) return;
+        using U = decltype(radix_key(key_fn(list.head->data)));
+        struct Record {
+            U key; //!< The order-preserving key.
+            std::size_t position; //!< Index of the node in the original order.
+        };
+        std::vector<std::shared_ptr<Node>> nodes;
+        nodes.reserve(list.list_size);
+        std::vector<Record> records(list.list_size);
+        U varying = 0;
+        list.mark_hash_stale();
+        try {
+            while (list.head) {
+                U key = radix_key(key_fn(list.head->data));
+                records[nodes.size()] = Record{key, nodes.size()};
+                varying |= static_cast<U>(key ^ records[0].key);
+                std::shared_ptr<Node> node = std::move(list.head);
+                list.head = std::move(node->next);
+                nodes.push_back(std::move(node));
+            }
+        } catch (...) {
+            std::shared_ptr<Node> rest = std::move(list.head);
+            for (std::size_t i = nodes.size(); i-- > 0;) {
+                nodes[i]->next = std::move(rest);
+                rest = std::move(nodes[i]);
+            }
+            list.head = std::move(rest);
+            throw;
+        }
+        std::vector<Record> scratch(records.size());
+        for (std::size_t shift = 0; shift < 8 * sizeof(U); shift += 8) {
+            if (((varying >> shift) & 0xFF) == 0) continue;
+            std::size_t offsets[256] = {};
+            for (const Record& record : records) ++offsets[(record.key >> shift) & 0xFF];
+            std::size_t sum = 0;
+            for (std::size_t& offset : offsets) {
+                std::size_t count = offset;
+                offset = sum;
+                sum += count;
+            }
+            for (const Record& record : records) scratch[offsets[(record.key >> shift) & 0xFF]++] = record;
+            records.swap(scratch);
+        }
+        list.tail = nodes[records.back().position].get();
+        for (std::size_t i = records.size(); i-- > 0;) {
+            std::shared_ptr<Node>& node = nodes[records[i].position];
+            node->next = std::move(list.head);
+            list.head = std::move(node);
+        }
+    }
+
+    /**
+     * @brief Relinks the k smallest elements, in sorted order, to the front of a list.
+     *
+     * One traversal keeps a bounded max-heap of pointers to the k best nodes seen so far and
+     * their predecessors, for O(n log k) comparisons. The k nodes are then sorted, detached
+     * through their predecessors and relinked at the front. The remaining elements keep their
+     * relative order behind them. Equal elements keep their relative order too. No element is
+     * copied. If comp throws, the list is left unchanged.
+     *
+     * @param list The list to reorder.
+     * @param k The number of smallest elements to bring to the front; the whole list is sorted
+     *        if k is at least its size.
+     * @param comp The strict weak ordering.
+     */
+    template<typename Compare = std::less<>>
+    friend void partial_sort_top_k(SinglyLinkedList& list, std::size_t k, Compare comp = Compare()) {
+        if (k == 0 || list.list_size < 2) return;
+        if (k >= list.list_size) {
+            list.sort(comp);
+            return;
+        }
+        struct Candidate {
+            Node* node; //!< The candidate node.
+            Node* previous; //!< The node before it, or null for the head.
+            std::size_t position; //!< Index of the node in the list.
+            std::size_t rank; //!< Index of the node among the k smallest once they are sorted.
+        };
+        auto better = [&comp](const Candidate& a, const Candidate& b) {
+            if (comp(a.node->data, b.node->data)) return true;
+            if (comp(b.node->data, a.node->data)) return false;
+            return a.position < b.position;
+        };
+        std::vector<Candidate> heap;
+        heap.reserve(k);
+        std::size_t position = 0;
+        Node* previous = nullptr;
+        for (Node* node = list.head.get(); node; previous = node, node = node->next.get(), ++position) {
+            Candidate candidate{node, previous, position, 0};
+            if (heap.size() < k) {
+                heap.push_back(candidate);
+                std::push_heap(heap.begin(), heap.end(), better);
+            } else if (better(candidate, heap.front())) {
+                std::pop_heap(heap.begin(), heap.end(), better);
+                heap.back() = candidate;
+                std::push_heap(heap.begin(), heap.end(), better);
+            }
+        }
+        std::sort(heap.begin(), heap.end(), better);
+        for (std::size_t i = 0; i < k; ++i) heap[i].rank = i;
+        std::sort(heap.begin(), heap.end(), [](const Candidate& a, const Candidate& b) { return a.position > b.position; });
+
+        // Detaching from the back keeps every recorded predecessor linked when it is used.
+        list.mark_hash_stale();
+        std::vector<std::shared_ptr<Node>> smallest(k);
+        for (const Candidate& candidate : heap) {
+            std::shared_ptr<Node>& link = candidate.previous ? candidate.previous->next : list.head;
+            smallest[candidate.rank] = std::move(link);
+            link = std::move(smallest[candidate.rank]->next);
+            if (list.tail == candidate.node) list.tail = candidate.previous;
+        }
+        for (std::size_t i = k; i-- > 0;) {
+            smallest[i]->next = std::move(list.head);
+            list.head = std::move(smallest[i]);
+        }
+    }
+
+    /**
+     * @brief Partially sorts a list so that the element at index n is the one a full sort would put there.
+     *
+     * Quickselect by relinking: each round picks a random pivot and splits the remaining chain
+     * into chains of smaller, equivalent and larger elements, then continues into the chain that
+     * holds index n. Takes expected O(n) comparisons and never copies an element. Elements
+     * before index n are not greater than it, and elements after it are not smaller. If comp
+     * throws, every element is kept, in an unspecified order.
+     *
+     * @param list The list to partition.
+     * @param n The index of the element to place.
+     * @param comp The strict weak ordering.
+     * @return A reference to the element now at index n.
+     * @throws std::out_of_range if n is not less than the size of the list.
+     */
+    template<typename Compare = std::less<>>
+    friend T& nth_element(SinglyLinkedList& list, std::size_t n, Compare comp = Compare()) {
+        if (n >= list.list_size) throw std::out_of_range("Index out of range");
+        static thread_local std::minstd_rand engine;
+        Chain prefix, less, equal, greater;
+        std::shared_ptr<Node> rest = std::move(list.head);
+        std::shared_ptr<Node> suffix;
+        std::size_t remaining = list.list_size;
+        Node* found = nullptr;
+        try {
+            while (!found) {
+                Node* pivot = rest.get();
+                for (std::size_t steps = engine() % remaining; steps > 0; --steps) pivot = pivot->next.get();
+                while (rest) {
+                    if (comp(rest->data, pivot->data)) {
+                        less.take_from(rest);
+                    } else if (comp(pivot->data, rest->data)) {
+                        greater.take_from(rest);
+                    } else {
+                        equal.take_from(rest);
+                    }
+                }
+                if (n < less.length) {
+                    *greater.link = std::move(suffix);
+                    equal.append(greater);
+                    suffix = std::move(equal.head);
+                    equal.reset();
+                    remaining = less.length;
+                    rest = std::move(less.head);
+                    less.reset();
+                } else if (n < less.length + equal.length) {
+                    found = equal.head.get();
+                    for (std::size_t i = less.length; i < n; ++i) found = found->next.get();
+                    prefix.append(less);
+                    prefix.append(equal);
+                    prefix.append(greater);
+                } else {
+                    n -= less.length + equal.length;
+                    prefix.append(less);
+                    prefix.append(equal);
+                    remaining = greater.length;
+                    rest = std::move(greater.head);
+                    greater.reset();
+                }
+            }
+        } catch (...) {
+            prefix.append(less);
+            prefix.append(equal);
+            prefix.append(greater);
+            prefix.append(rest);
+            prefix.append(suffix);
+            list.head = std::move(prefix.head);
+            list.relink_tail();
+            throw;
+        }
+        prefix.append(suffix);
+        list.head = std::move(prefix.head);
+        list.relink_tail();
+        return found->data;
+    }
+
+    /**
+     * @brief Computes the union of two sorted lists into a new list, copying the elements.
+     *
+     * Like std::set_union, an element present m times in a and n times in b appears
+     * max(m, n) times, the copies from a first.
+     *
+     * @param a The first sorted list.
+     * @param b The second sorted list.
+     * @param comp The strict weak ordering both lists are sorted by.
+     * @return The sorted union.
+     */
+    template<typename Compare = std::less<>>
+    friend SinglyLinkedList set_union(const SinglyLinkedList& a, const SinglyLinkedList& b, Compare comp = Compare()) {
+        return copy_set_operation(a, b, SetOperation::Union, comp);
+    }
+
+    /**
+     * @brief Computes the union of two sorted lists by relinking their nodes; both are left empty.
+     * @param a The first sorted list.
+     * @param b The second sorted list.
+     * @param comp The strict weak ordering both lists are sorted by.
+     * @return The sorted union, built from the inputs' nodes.
+     */
+    template<typename Compare = std::less<>>
+    friend SinglyLinkedList set_union(SinglyLinkedList&& a, SinglyLinkedList&& b, Compare comp = Compare()) {
+        return relink_set_operation(a, b, SetOperation::Union, comp);
+    }
+
+    /**
+     * @brief Computes the intersection of two sorted lists into a new list, copying the elements.
+     *
+     * Like std::set_intersection, an element present m times in a and n times in b appears
+     * min(m, n) times, copied from a.
+     *
+     * @param a The first sorted list.
+     * @param b The second sorted list.
+     * @param comp The strict weak ordering both lists are sorted by.
+     * @return The sorted intersection.
+     */
+    template<typename Compare = std::less<>>
+    friend SinglyLinkedList set_intersection(const SinglyLinkedList& a, const SinglyLinkedList& b, Compare comp = Compare()) {
+        return copy_set_operation(a, b, SetOperation::Intersection, comp);
+    }
+
+    /**
+     * @brief Computes the intersection of two sorted lists by relinking their nodes; both are left empty.
+     * @param a The first sorted list.
+     * @param b The second sorted list.
+     * @param comp The strict weak ordering both lists are sorted by.
+     * @return The sorted intersection, built from a's nodes.
+     */
+    template<typename Compare = std::less<>>
+    friend SinglyLinkedList set_intersection(SinglyLinkedList&& a, SinglyLinkedList&& b, Compare comp = Compare()) {
+        return relink_set_operation(a, b, SetOperation::Intersection, comp);
+    }
+
+    /**
+     * @brief Computes the difference of two sorted lists into a new list, copying the elements.
+     *
+     * Like std::set_difference, an element present m times in a and n times in b appears
+     * max(m - n, 0) times.
+     *
+     * @param a The sorted list to take elements from.
+     * @param b The sorted list of elements to leave out.
+     * @param comp The strict weak ordering both lists are sorted by.
+     * @return The sorted difference.
+     */
+    template<typename Compare = std::less<>>
+    friend SinglyLinkedList set_difference(const SinglyLinkedList& a, const SinglyLinkedList& b, Compare comp = Compare()) {
+        return copy_set_operation(a, b, SetOperation::Difference, comp);
+    }
+
+    /**
+     * @brief Computes the difference of two sorted lists by relinking their nodes; both are left empty.
+     * @param a The sorted list to take elements from.
+     * @param b The sorted list of elements to leave out.
+     * @param comp The strict weak ordering both lists are sorted by.
+     * @return The sorted difference, built from a's nodes.
+     */
+    template<typename Compare = std::less<>>
+    friend SinglyLinkedList set_difference(SinglyLinkedList&& a, SinglyLinkedList&& b, Compare comp = Compare()) {
+        return relink_set_operation(a, b, SetOperation::Difference, comp);
+    }
+
+    /**
+     * @brief A skip index over a sorted list: a pointer to every stride-th node.
+     *
+     * A linked list cannot be searched without walking it, so intersecting a short list with a
+     * long one costs a walk over the long one. A SkipIndex pays that walk once; intersections
+     * through it then gallop over the index and walk at most stride nodes per element of the
+     * short list. The index is invalidated by any modification of the indexed list.
+     */
+    class SkipIndex {
+    public:
+        /**
+         * @brief Builds the index in one traversal.
+         * @param list The sorted list to index.
+         * @param stride The distance between indexed nodes; at least 1.
+         */
+        explicit SkipIndex(const SinglyLinkedList& list, std::size_t stride = 64) : step(std::max<std::size_t>(stride, 1)) {
+            std::size_t index = 0;
+            for (Node* node = list.head.get(); node; node = node->next.get(), ++index) {
+                if (index % step == 0) marks.push_back(node);
+            }
+        }
+
+        /**
+         * @brief Gets the distance between indexed nodes.
+         * @return The stride.
+         */
+        std::size_t stride() const { return step; }
+
+        /**
+         * @brief Intersects a sorted list with the indexed list, copying the kept elements from a.
+         * @param a The short sorted list.
+         * @param comp The strict weak ordering both lists are sorted by.
+         * @return The sorted intersection.
+         */
+        template<typename Compare = std::less<>>
+        SinglyLinkedList intersect(const SinglyLinkedList& a, Compare comp = Compare()) const {
+            SinglyLinkedList result(a.alloc);
+            if (marks.empty()) return result;
+            Node* cursor = marks.front();
+            std::size_t position = 0;
+            auto before = [&comp](const T& x) { return [&comp, &x](const Node* mark) { return comp(mark->data, x); }; };
+            for (Node* x = a.head.get(); x && cursor; x = x->next.get()) {
+                if (comp(cursor->data, x->data)) {
+                    std::size_t low = position / step + 1;
+                    if (low < marks.size() && comp(marks[low]->data, x->data)) {
+                        std::size_t high = low + 1;
+                        for (std::size_t jump = 1; high < marks.size() && comp(marks[high]->data, x->data); jump *= 2) {
+                            low = high;
+                            high = low + 2 * jump;
+                        }
+                        high = std::min(high, marks.size());
+                        auto first = std::partition_point(marks.begin() + static_cast<std::ptrdiff_t>(low) + 1,
+                                                          marks.begin() + static_cast<std::ptrdiff_t>(high), before(x->data));
+                        std::size_t mark = static_cast<std::size_t>(first - marks.begin()) - 1;
+                        cursor = marks[mark];
+                        position = mark * step;
+                    }
+                    while (cursor && comp(cursor->data, x->data)) {
+                        cursor = cursor->next.get();
+                        ++position;
+                    }
+                }
+                if (cursor && !comp(x->data, cursor->data)) {
+                    result.push_back(x->data);
+                    cursor = cursor->next.get();
+                    ++position;
+                }
+            }
+            return result;
+        }
+
+    private:
+        std::size_t step; //!< The distance between indexed nodes.
+        std::vector<Node*> marks; //!< Every stride-th node of the list.
+    };
+
+    /**
+     * @brief Computes the intersection of a sorted list with an indexed sorted list, copying from a.
+     *
+     * For every element of a, the index is galloped forward to the last indexed node before
+     * the element and the long list is walked from there, so the cost is
+     * O(|a| (log(|b| / stride) + stride)) instead of O(|a| + |b|).
+     *
+     * @param a The short sorted list.
+     * @param b The index over the long sorted list.
+     * @param comp The strict weak ordering both lists are sorted by.
+     * @return The sorted intersection, with the same multiplicities as std::set_intersection.
+     */
+    template<typename Compare = std::less<>>
+    friend SinglyLinkedList set_intersection(const SinglyLinkedList& a, const SkipIndex& b, Compare comp = Compare()) {
+        return b.intersect(a, comp);
+    }
+
+    /**
+     * @brief Merges many sorted lists into one sorted list by relinking their nodes.
+     *
+     * A loser tree keyed on the list heads picks each next node with O(log k) comparisons, for
+     * O(N log k) in total, and no element is copied. Every input list is left empty. Equal
+     * elements keep the order of their lists, so the merge is stable.
+     *
+     * With threads > 1, splitter keys are sampled from the lists and every list is cut into
+     * pieces at the splitters; each thread then merges the pieces of one key range and the
+     * results are concatenated. comp is copied to every thread and must be safe to call
+     * concurrently. Sampling and cutting add two walks over the nodes, which pays off when k
+     * is large. Ranges whose thread cannot be started are merged on the calling thread.
+     *
+     * If comp throws, every element is kept by the input lists, in an unspecified order.
+     *
+     * @param lists The sorted lists to merge.
+     * @param comp The strict weak ordering every list is sorted by.
+     * @param threads The number of threads to merge on, including the calling thread.
+     * @return The merged list.
+     */
+    template<typename Compare = std::less<>>
+    friend SinglyLinkedList merge_k(std::span<SinglyLinkedList> lists, Compare comp = Compare(), std::size_t threads = 1) {
+        std::size_t total = 0;
+        for (const SinglyLinkedList& list : lists) total += list.list_size;
+        threads = std::min(threads, total / 4096 + 1);
+        if (threads <= 1) return loser_tree_merge(lists, comp);
+
+        // Sample about 64 keys per range, sort them and pick evenly spaced splitters.
+        std::size_t gap = std::max<std::size_t>(total / (threads * 64), 1);
+        std::vector<const T*> samples;
+        std::size_t seen = 0;
+        for (const SinglyLinkedList& list : lists) {
+            for (const Node* node = list.head.get(); node; node = node->next.get()) {
+                if (seen++ % gap == 0) samples.push_back(&node->data);
+            }
+        }
+        if (samples.size() < threads) return loser_tree_merge(lists, comp);
+        std::sort(samples.begin(), samples.end(), [&comp](const T* a, const T* b) { return comp(*a, *b); });
+        std::vector<const T*> splitters;
+        for (std::size_t j = 1; j < threads; ++j) splitters.push_back(samples[j * samples.size() / threads]);
+
+        // cuts[i * (threads - 1) + j] counts the elements of list i in key range j. Every
+        // comparison is made before any list is cut, so a throwing comp leaves the lists intact.
+        std::vector<std::size_t> cuts;
+        cuts.reserve(lists.size() * (threads - 1));
+        for (const SinglyLinkedList& list : lists) {
+            const Node* node = list.head.get();
+            for (std::size_t j = 0; j + 1 < threads; ++j) {
+                std::size_t count = 0;
+                for (; node && comp(node->data, *splitters[j]); node = node->next.get()) ++count;
+                cuts.push_back(count);
+            }
+        }
+
+        // pieces[j] holds, from every list, the elements in key range j. The splitters point
+        // into nodes that stay alive while the lists are cut, and cutting cannot throw.
+        std::vector<std::vector<SinglyLinkedList>> pieces(threads);
+        for (std::vector<SinglyLinkedList>& range : pieces) range.reserve(lists.size());
+        for (std::size_t i = 0; i < lists.size(); ++i) {
+            for (std::size_t j = 0; j + 1 < threads; ++j) {
+                std::size_t count = cuts[i * (threads - 1) + j];
+                pieces[j].push_back(count > 0 ? lists[i].take_front(count) : SinglyLinkedList(lists[i].alloc));
+            }
+            pieces[threads - 1].push_back(std::move(lists[i]));
+        }
+
+        std::vector<SinglyLinkedList> results(threads);
+        std::vector<std::exception_ptr> errors(threads);
+        auto mergeRange = [&pieces, &results, &errors, comp](std::size_t j) mutable {
+            try {
+                results[j] = loser_tree_merge(std::span<SinglyLinkedList>(pieces[j]), comp);
+            } catch (...) {
+                errors[j] = std::current_exception();
+            }
+        };
+        // Ranges left without a thread, when one cannot be started, are merged on this thread.
+        std::vector<std::thread> workers;
+        std::size_t started = 1;
+        try {
+            workers.reserve(threads - 1);
+            for (; started < threads; ++started) workers.emplace_back(mergeRange, started);
+        } catch (...) {
+        }
+        for (std::size_t j = started; j < threads; ++j) mergeRange(j);
+        mergeRange(0);
+        for (std::thread& worker : workers) worker.join();
+
+        SinglyLinkedList merged(lists.front().alloc);
+        for (std::size_t j = 0; j < threads; ++j) {
+            if (errors[j]) {
+                for (std::vector<SinglyLinkedList>& range : pieces) {
+                    for (SinglyLinkedList& piece : range) append_nodes(lists.front(), piece);
+                }
+                for (SinglyLinkedList& result : results) append_nodes(lists.front(), result);
+                std::rethrow_exception(errors[j]);
+            }
+        }
+        for (SinglyLinkedList& result : results) append_nodes(merged, result);
+        return merged;
+    }
+
+    /**
+     * @brief Scatters a list into n lists by the hash of a key, relinking its nodes in one pass.
+     *
+     * Element e goes to list std::hash of key_fn(e), modulo n. Every bucket keeps a tail link,
+     * so each node is relinked in O(1); no node is allocated and no element is moved or
+     * copied. Elements keep their relative order within each list. If key_fn or the hash
+     * throws, every element is kept by the list, in an unspecified order.
+     *
+     * @param list The list to empty.
+     * @param n The number of lists to scatter into.
+     * @param key_fn Callable returning the key of an element.
+     * @return The n lists, sharing the list's allocator and node pool.
+     * @throws std::invalid_argument if n is zero.
+     */
+    template<typename KeyFn>
+    friend std::vector<SinglyLinkedList> partition_into(SinglyLinkedList& list, std::size_t n, KeyFn key_fn) {
+        if (n == 0) {
+            throw std::invalid_argument("Partition count must be positive.");
+        }
+        using Key = std::decay_t<decltype(key_fn(list.head->data))>;
+        std::hash<Key> hasher;
+        std::vector<Chain> buckets(n);
+        std::shared_ptr<Node> rest = std::move(list.head);
+        list.tail = nullptr;
+        list.list_size = 0;
+        list.mark_hash_stale();
+        try {
+            while (rest) buckets[hasher(key_fn(rest->data)) % n].take_from(rest);
+        } catch (...) {
+            Chain kept;
+            for (Chain& bucket : buckets) kept.append(bucket);
+            kept.append(rest);
+            adopt(list, kept);
+            throw;
+        }
+        std::vector<SinglyLinkedList> parts;
+        parts.reserve(n);
+        for (Chain& bucket : buckets) {
+            parts.emplace_back(list.alloc);
+            parts.back().pool = list.pool;
+            adopt(parts.back(), bucket);
+        }
+        return parts;
+    }
+
+    /**
+     * @brief Concatenates lists into one, in O(1) per list, without copying or moving elements.
+     *
+     * The inverse of partition_into(), up to the order of the elements. Every list is left empty.
+     *
+     * @param lists The lists to concatenate, in order.
+     * @return The concatenation, with the first list's allocator and node pool.
+     */
+    friend SinglyLinkedList gather(std::span<SinglyLinkedList> lists) {
+        SinglyLinkedList gathered;
+        if (lists.empty()) return gathered;
+        gathered.alloc = lists.front().alloc;
+        gathered.pool = lists.front().pool;
+        for (SinglyLinkedList& list : lists) append_nodes(gathered, list);
+        return gathered;
+    }
+
+    /**
+     * @brief Computes a rolling hash of the elements in one pass and starts maintaining it.
+     *
+     * The hash is a polynomial over the elements' std::hash values modulo 2^61 - 1. Once
+     * tracked, push_back(), push_front(), pop_front() and pop_back() update it in O(1), and
+     * clear() resets it. Every other change to the list, and handing out a mutable reference or
+     * Iterator to an element, marks it stale; it stays stale until track_hash() is called again.
+     * Writes through references or Iterators obtained before track_hash() are not noticed.
+     * A list assigned from or to an aliasing copy does not use its hash until it is cleared.
+     */
+    void track_hash() {
+        static_assert(hashable, "track_hash requires std::hash<T>.");
+        rolling.tracked = true;
+        rolling.value = compute_hash(rolling.power);
+        rolling.valid.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the rolling hash of the elements.
+     *
+     * O(1) while a tracked hash is up to date; otherwise one pass over the list, whose result
+     * is not kept, so that concurrent readers do not write to the list. Lists with equal
+     * elements have equal hashes.
+     *
+     * @return The hash, below 2^61 - 1.
+     */
+    std::uint64_t content_hash() const {
+        static_assert(hashable, "content_hash requires std::hash<T>.");
+        if (hash_valid()) return rolling.value;
+        std::uint64_t power;
+        return compute_hash(power);
     }
 
     /**
      * @brief Check if this list is equal to another list.
+     *
+     * Lists whose tracked hashes are both up to date and differ are unequal in O(1).
+     *
      * @param other The list to be compared with this list.
      * @return Whether the two lists are equal.
      */
-    bool operator==(const SinglyLinkedList<T>& other) const {
+    bool operator==(const SinglyLinkedList& other) const {
         if (this->size() != other.size()) return false;
-        auto it1 = this->begin();
-        auto it2 = other.begin();
-        while (it1 != this->end() && it2 != other.end()) {
-            if (*it1 != *it2) return false;
-            ++it1;
-            ++it2;
+        if (hash_valid() && other.hash_valid() && rolling.value != other.rolling.value) return false;
+        // Once both walks reach the same node, the rest is shared: aliasing copies, or a common suffix.
+        // The walk is bounded by size(), since a list sharing nodes may end before its chain does.
+        const Node* a = head.get();
+        const Node* b = other.head.get();
+        for (std::size_t remaining = list_size; remaining != 0 && a != b; --remaining) {
+            if (a->data != b->data) return false;
+            a = a->next.get();
+            b = b->next.get();
         }
         return true;
     }
 
+    /**
+     * @brief Compares two lists lexicographically.
+     *
+     * Uses T's operator<=> if it has one and operator< otherwise. The walk covers the shorter
+     * list's size() elements, and stops early once both lists reach the same node, since their
+     * common elements are then shared and only the sizes can differ.
+     *
+     * @param a The first list.
+     * @param b The second list.
+     * @return The ordering of a relative to b.
+     */
+    friend auto operator<=>(const SinglyLinkedList& a, const SinglyLinkedList& b) {
+        using Ordering = decltype(synth_three_way(a.head->data, b.head->data));
+        const Node* x = a.head.get();
+        const Node* y = b.head.get();
+        for (std::size_t remaining = std::min(a.list_size, b.list_size); remaining != 0 && x != y; --remaining) {
+            Ordering order = synth_three_way(x->data, y->data);
+            if (order != 0) return order;
+            x = x->next.get();
+            y = y->next.get();
+        }
+        return Ordering(a.list_size <=> b.list_size);
+    }
+
     /**
      * @brief Check if this list is not equal to another list.
      * @param other The list to be compared with this list.
      * @return Whether the two lists are not equal.
      */
-    bool operator!=(const SinglyLinkedList<T>& other) const {
+    bool operator!=(const SinglyLinkedList& other) const {
         return !(*this == other);
     }
 
@@ -541,6 +2341,11 @@ public:
         using pointer = T*;
         using reference = T&;
 
+        /**
+         * @brief Constructs a singular Iterator, equal to end().
+         */
+        Iterator() : current(nullptr) {}
+
         /**
          * @brief Constructs an Iterator starting at the given node.
          * @param start The starting node.
@@ -601,25 +2406,57 @@ public:
     class ConstIterator : public Iterator {
     public:
         using Iterator::Iterator;
+        using pointer = const T*;
+        using reference = const T&;
+
+        /**
+         * @brief Constructs a singular ConstIterator, equal to end().
+         */
+        ConstIterator() = default;
 
         /**
          * @brief Dereferences the iterator to access the current element (const version).
          * @return Const reference to the current element.
          */
-        const T& operator*() const { return Iterator::operator*(); }
+        const T& operator*() const { return this->current->data; }
 
         /**
          * @brief Accesses the current element through the iterator (const version).
          * @return Const pointer to the current element.
          */
-        const T* operator->() const { return Iterator::operator->(); }
+        const T* operator->() const { return &this->current->data; }
+
+        /**
+         * @brief Advances the iterator to the next element.
+         * @return Reference to this iterator.
+         */
+        ConstIterator& operator++() {
+            Iterator::operator++();
+            return *this;
+        }
+
+        /**
+         * @brief Advances the iterator to the next element (postfix).
+         * @return The previous state of the iterator.
+         */
+        ConstIterator operator++(int) {
+            ConstIterator temp = *this;
+            Iterator::operator++();
+            return temp;
+        }
     };
 
     /**
      * @brief Gets an iterator to the beginning of the list.
+     *
+     * The Iterator allows writing the elements, so the content hash is marked stale.
+     *
      * @return An Iterator pointing to the first element.
      */
-    Iterator begin() { return Iterator(head.get()); }
+    Iterator begin() {
+        mark_hash_stale();
+        return Iterator(head.get());
+    }
 
     /**
      * @brief Gets an iterator to the end of the list.
@@ -641,8 +2478,16 @@ public:
 
 };
 
-template<typename T>
-void printList(const SinglyLinkedList<T>& list) {
+template<std::input_iterator It>
+SinglyLinkedList(It, It) -> SinglyLinkedList<std::iter_value_t<It>>;
+
+#if defined(__cpp_lib_containers_ranges)
+template<std::ranges::input_range R>
+SinglyLinkedList(std::from_range_t, R&&) -> SinglyLinkedList<std::ranges::range_value_t<R>>;
+#endif
+
+template<typename T, typename Allocator>
+void printList(const SinglyLinkedList<T, Allocator>& list) {
     std::cout << "{";
     for (int i = 0; i < list.size(); ++i) {
         std::cout << list.get(i);
@@ -651,4 +2496,20 @@ void printList(const SinglyLinkedList<T>& list) {
     std::cout << "}" << std::endl;
 }
 
+/**
+ * @brief Hashes a SinglyLinkedList by its elements, so that lists can key unordered containers.
+ *
+ * O(1) for a list whose tracked hash is up to date, one pass over the list otherwise.
+ */
+namespace std {
+template<typename T, typename Allocator>
+struct hash<SinglyLinkedList<T, Allocator>> {
+    std::size_t operator()(const SinglyLinkedList<T, Allocator>& list) const {
+        std::uint64_t z = list.content_hash() ^ (static_cast<std::uint64_t>(list.size()) * 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 32)) * 0xd6e8feb86659fd93;
+        return static_cast<std::size_t>(z ^ (z >> 32));
+    }
+};
+} // namespace std
+
 #endif // SINGLYLINKEDLIST_HPP
\ No newline at end of file
@@ -0,0 +1,575 @@
+#include "SinglyLinkedListRanges.hpp"
+#include "ThreadCachingAllocator.hpp"
+#include "HugePageArena.hpp"
+#include "AggregatingList.hpp"
+#include "MonotonicQueue.hpp"
+#include "CompressedIntList.hpp"
+#include "HandleList.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <unordered_set>
+#include <vector>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * @brief Runs a callable several times and reports the best wall-clock time.
+ * @param name The label printed with the result.
+ * @param reps The number of repetitions.
+ * @param fn The callable to time; its result is accumulated to keep it observable.
+ * @return The best time in milliseconds.
+ */
+template<typename Fn>
+double benchmark(const std::string& name, int reps, Fn fn) {
+    double best = 1e300;
+    std::uint64_t sink = 0;
+    for (int r = 0; r < reps; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        sink += static_cast<std::uint64_t>(fn());
+        auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    std::cout << std::left << std::setw(48) << name << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+              << best << " ms  (checksum " << sink % 1000 << ")\n";
+    return best;
+}
+
+/**
+ * @brief Counts data TLB read misses of the calling thread through perf_event_open.
+ *
+ * Hosts without hardware counters, or that forbid them, make the counter unavailable.
+ */
+class DtlbCounter {
+public:
+    DtlbCounter() {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+    ~DtlbCounter() { if (fd >= 0) close(fd); }
+    DtlbCounter(const DtlbCounter&) = delete;
+    DtlbCounter& operator=(const DtlbCounter&) = delete;
+
+    /**
+     * @brief Counts the misses incurred by a callable.
+     * @param fn The callable to measure.
+     * @return The miss count, or "n/a" if the counter is unavailable.
+     */
+    template<typename Fn>
+    std::string count(Fn fn) {
+        if (fd < 0) {
+            fn();
+            return "n/a";
+        }
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        fn();
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long misses = 0;
+        if (read(fd, &misses, sizeof(misses)) != static_cast<ssize_t>(sizeof(misses))) return "n/a";
+        return std::to_string(misses);
+    }
+
+private:
+    int fd; //!< The perf event, or -1 if unavailable.
+};
+
+void benchmarkPipeline() {
+    std::cout << "== filter | transform | take pipeline, 2M ints ==\n";
+    SinglyLinkedList<std::uint64_t> list;
+    for (std::uint64_t i = 0; i < 2000000; ++i) list.push_back(i);
+    auto keep = [](std::uint64_t x) { return x % 3 != 0; };
+    auto scale = [](std::uint64_t x) { return x * 7 + 1; };
+
+    benchmark("eager: one SinglyLinkedList per stage", 5, [&] {
+        SinglyLinkedList<std::uint64_t> filtered;
+        for (auto x : list) if (keep(x)) filtered.push_back(x);
+        SinglyLinkedList<std::uint64_t> mapped;
+        for (auto x : filtered) mapped.push_back(scale(x));
+        SinglyLinkedList<std::uint64_t> taken;
+        for (auto x : mapped) {
+            if (taken.size() == 1000000) break;
+            taken.push_back(x);
+        }
+        return taken.back();
+    });
+    benchmark("fused: views::filter | transform | take", 5, [&] {
+        auto out = list | std::views::filter(keep) | std::views::transform(scale) | std::views::take(1000000)
+                        | sll::to<SinglyLinkedList>();
+        return out.back();
+    });
+}
+
+/**
+ * @brief Moves nodes from a producer thread to a consumer thread that frees them.
+ * @tparam List The list type, which selects the node allocator.
+ * @param batches The number of lists handed over.
+ * @param batchSize The number of elements in every list.
+ * @return The sum of all consumed elements.
+ */
+template<typename List>
+std::uint64_t crossThreadQueue(int batches, int batchSize) {
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<List> handoff;
+    bool done = false;
+    std::thread producer([&] {
+        for (int b = 0; b < batches; ++b) {
+            List local;
+            for (int i = 0; i < batchSize; ++i) local.push_back(static_cast<std::uint64_t>(i));
+            std::lock_guard<std::mutex> lock(mutex);
+            handoff.push_back(std::move(local));
+            ready.notify_one();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+        ready.notify_one();
+    });
+    std::uint64_t total = 0;
+    for (;;) {
+        List batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ready.wait(lock, [&] { return !handoff.empty() || done; });
+            if (handoff.empty()) break;
+            batch = std::move(handoff.front());
+            handoff.pop_front();
+        }
+        while (!batch.empty()) {
+            total += batch.front();
+            batch.pop_front();
+        }
+    }
+    producer.join();
+    return total;
+}
+
+void benchmarkCrossThreadQueue() {
+    std::cout << "== producer/consumer handoff, 4M nodes in batches of 1000 ==\n";
+    benchmark("std::allocator", 5, [] {
+        return crossThreadQueue<SinglyLinkedList<std::uint64_t>>(4000, 1000);
+    });
+    benchmark("ThreadCachingAllocator", 5, [] {
+        return crossThreadQueue<SinglyLinkedList<std::uint64_t, ThreadCachingAllocator<std::uint64_t>>>(4000, 1000);
+    });
+}
+
+/**
+ * @brief Builds lists whose nodes are interleaved in memory, then times a full traversal.
+ * @param name The label printed with the result.
+ * @param lanes The lists, pushed to round-robin so consecutive nodes of one list sit far apart.
+ */
+template<typename List>
+void traverseInterleaved(const std::string& name, std::vector<List>& lanes) {
+    for (std::uint64_t i = 0; i < 8000000; ++i) lanes[i % lanes.size()].push_back(i);
+    auto traverse = [&] {
+        std::uint64_t sum = 0;
+        for (const List& lane : lanes) {
+            for (std::uint64_t x : lane) sum += x;
+        }
+        return sum;
+    };
+    benchmark(name, 5, traverse);
+    DtlbCounter counter;
+    std::cout << "    dTLB read misses: " << counter.count(traverse) << "\n";
+}
+
+void benchmarkHugePages() {
+    std::cout << "== traversal of 8M nodes interleaved over 500 lists ==\n";
+    {
+        std::vector<SinglyLinkedList<std::uint64_t>> lanes(500);
+        traverseInterleaved("std::allocator, 4 KiB pages", lanes);
+    }
+    auto arena = std::make_shared<HugePageArena>();
+    using List = SinglyLinkedList<std::uint64_t, HugePageAllocator<std::uint64_t>>;
+    std::vector<List> lanes(500, List{HugePageAllocator<std::uint64_t>(arena)});
+    traverseInterleaved("HugePageArena", lanes);
+    const char* backing[] = {"MAP_HUGETLB", "MADV_HUGEPAGE", "normal pages (fallback)"};
+    std::cout << "    arena backing: " << backing[static_cast<int>(arena->backing())] << "\n";
+}
+
+void benchmarkSort() {
+    std::cout << "== sort 1M random 64-bit keys ==\n";
+    const int reps = 5;
+    auto fresh = [] {
+        std::vector<SinglyLinkedList<std::uint64_t>> lists(reps);
+        std::uint64_t state = 88172645463325252ULL;
+        for (auto& list : lists) {
+            for (int i = 0; i < 1000000; ++i) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                list.push_back(state);
+            }
+        }
+        return lists;
+    };
+    auto lists = fresh();
+    int rep = 0;
+    benchmark("radix_sort by relinking", reps, [&] {
+        SinglyLinkedList<std::uint64_t>& list = lists[rep++];
+        radix_sort(list, [](std::uint64_t x) { return x; });
+        return list.front();
+    });
+    lists = fresh();
+    rep = 0;
+    benchmark("sort (merge sort by relinking)", reps, [&] {
+        SinglyLinkedList<std::uint64_t>& list = lists[rep++];
+        list.sort();
+        return list.front();
+    });
+    lists = fresh();
+    rep = 0;
+    benchmark("to_vector + std::sort", reps, [&] {
+        std::vector<std::uint64_t> values = lists[rep++].to_vector();
+        std::sort(values.begin(), values.end());
+        return values.front();
+    });
+}
+
+void benchmarkTopK() {
+    std::cout << "== top 100 of 2M random keys ==\n";
+    const int reps = 3;
+    auto fresh = [] {
+        std::vector<SinglyLinkedList<std::uint64_t>> lists(reps);
+        std::uint64_t state = 88172645463325252ULL;
+        for (auto& list : lists) {
+            for (int i = 0; i < 2000000; ++i) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                list.push_back(state);
+            }
+        }
+        return lists;
+    };
+    auto lists = fresh();
+    int rep = 0;
+    benchmark("partial_sort_top_k", reps, [&] {
+        SinglyLinkedList<std::uint64_t>& list = lists[rep++];
+        partial_sort_top_k(list, 100);
+        return list.front();
+    });
+    lists = fresh();
+    rep = 0;
+    benchmark("nth_element, then sort the first 100", reps, [&] {
+        SinglyLinkedList<std::uint64_t>& list = lists[rep++];
+        nth_element(list, 99);
+        SinglyLinkedList<std::uint64_t> top = list.take_front(100);
+        top.sort();
+        return top.front();
+    });
+    lists = fresh();
+    rep = 0;
+    benchmark("to_vector + std::partial_sort", reps, [&] {
+        std::vector<std::uint64_t> values = lists[rep++].to_vector();
+        std::partial_sort(values.begin(), values.begin() + 100, values.end());
+        return values.front();
+    });
+}
+
+void benchmarkIntersection() {
+    std::cout << "== intersect 1K postings with 4M postings ==\n";
+    SinglyLinkedList<std::uint32_t> large;
+    for (std::uint32_t i = 0; i < 4000000; ++i) large.push_back(i * 5);
+    SinglyLinkedList<std::uint32_t> small;
+    for (std::uint32_t i = 0; i < 1000; ++i) small.push_back(i * 19997);
+    benchmark("set_intersection, linear merge", 5, [&] {
+        return set_intersection(small, large).size();
+    });
+    SinglyLinkedList<std::uint32_t>::SkipIndex index(large);
+    benchmark("set_intersection through a SkipIndex", 5, [&] {
+        return set_intersection(small, index).size();
+    });
+    benchmark("building the SkipIndex", 5, [&] {
+        return SinglyLinkedList<std::uint32_t>::SkipIndex(large).stride();
+    });
+}
+
+void benchmarkMergeK() {
+    std::cout << "== merge 2000 sorted shards of 1000 keys ==\n";
+    const int reps = 3;
+    auto fresh = [] {
+        std::vector<std::vector<SinglyLinkedList<std::uint64_t>>> runs(reps);
+        for (auto& shards : runs) {
+            shards.resize(2000);
+            for (std::uint64_t s = 0; s < 2000; ++s) {
+                for (std::uint64_t i = 0; i < 1000; ++i) shards[s].push_back(i * 2000 + (s * 7919) % 2000);
+            }
+        }
+        return runs;
+    };
+    auto runs = fresh();
+    int rep = 0;
+    benchmark("merge_k, loser tree", reps, [&] {
+        return merge_k(std::span(runs[rep++])).back();
+    });
+    runs = fresh();
+    rep = 0;
+    unsigned threads = std::max(2u, std::thread::hardware_concurrency());
+    benchmark("merge_k, " + std::to_string(threads) + " threads", reps, [&] {
+        return merge_k(std::span(runs[rep++]), std::less<>(), threads).back();
+    });
+    runs = fresh();
+    rep = 0;
+    benchmark("collect into a vector + std::sort", reps, [&] {
+        std::vector<std::uint64_t> values;
+        for (const auto& shard : runs[rep]) values.insert(values.end(), shard.begin(), shard.end());
+        ++rep;
+        std::sort(values.begin(), values.end());
+        return values.back();
+    });
+}
+
+void benchmarkPartition() {
+    std::cout << "== shard 2M keys into 16 lists ==\n";
+    const int reps = 3;
+    auto fresh = [] {
+        std::vector<SinglyLinkedList<std::uint64_t>> inputs(reps);
+        for (auto& input : inputs) {
+            for (std::uint64_t i = 0; i < 2000000; ++i) input.push_back(i * 2654435761u);
+        }
+        return inputs;
+    };
+    auto inputs = fresh();
+    int rep = 0;
+    benchmark("partition_into + gather", reps, [&] {
+        auto parts = partition_into(inputs[rep++], 16, [](std::uint64_t key) { return key; });
+        return gather(std::span(parts)).size();
+    });
+    inputs = fresh();
+    rep = 0;
+    benchmark("push_back copies into 16 lists", reps, [&] {
+        std::vector<SinglyLinkedList<std::uint64_t>> parts(16);
+        for (std::uint64_t key : inputs[rep]) parts[std::hash<std::uint64_t>()(key) % 16].push_back(key);
+        inputs[rep++].clear();
+        SinglyLinkedList<std::uint64_t> gathered;
+        for (auto& part : parts) {
+            for (std::uint64_t key : part) gathered.push_back(key);
+        }
+        return gathered.size();
+    });
+}
+
+void benchmarkAggregates() {
+    std::cout << "== min/max/sum of a 1024-element sliding window, 200K steps ==\n";
+    const int reps = 3;
+    const std::size_t window = 1024;
+    benchmark("AggregatingList, two stacks", reps, [&] {
+        AggregatingList<std::uint64_t, MinMonoid<std::uint64_t>> mins;
+        AggregatingList<std::uint64_t, MaxMonoid<std::uint64_t>> maxes;
+        AggregatingList<std::uint64_t> sums;
+        std::uint64_t total = 0;
+        for (std::uint64_t i = 0; i < 200000; ++i) {
+            std::uint64_t value = (i * 2654435761u) % 100000;
+            mins.push_back(value);
+            maxes.push_back(value);
+            sums.push_back(value);
+            if (sums.size() > window) {
+                mins.pop_front();
+                maxes.pop_front();
+                sums.pop_front();
+            }
+            total += mins.aggregate() + maxes.aggregate() + sums.aggregate();
+        }
+        return total;
+    });
+    benchmark("SinglyLinkedList, traverse per query", reps, [&] {
+        SinglyLinkedList<std::uint64_t> items;
+        std::uint64_t total = 0;
+        for (std::uint64_t i = 0; i < 200000; ++i) {
+            items.push_back((i * 2654435761u) % 100000);
+            if (items.size() > window) items.pop_front();
+            std::uint64_t low = ~std::uint64_t(0), high = 0, sum = 0;
+            for (std::uint64_t value : items) {
+                low = std::min(low, value);
+                high = std::max(high, value);
+                sum += value;
+            }
+            total += low + high + sum;
+        }
+        return total;
+    });
+    benchmark("RangeAggregatingList, random range sums", reps, [&] {
+        RangeAggregatingList<std::uint64_t> ranged;
+        std::uint64_t total = 0;
+        for (std::uint64_t i = 0; i < 200000; ++i) {
+            ranged.insert((i * 2654435761u) % (ranged.size() + 1), i);
+            std::size_t first = (i * 40503u) % ranged.size();
+            total += ranged.aggregate(first, ranged.size());
+        }
+        return total;
+    });
+}
+
+void benchmarkMonotonicQueue() {
+    std::cout << "== min/max of a 1024-element window, 300K ticks ==\n";
+    const int reps = 3;
+    const std::size_t window = 1024;
+    benchmark("MonotonicQueue", reps, [&] {
+        MonotonicQueue<std::uint64_t> ticks(window);
+        std::uint64_t total = 0;
+        for (std::uint64_t i = 0; i < 300000; ++i) {
+            ticks.push((i * 2654435761u) % 100000);
+            total += ticks.min() + ticks.max();
+        }
+        return total;
+    });
+    benchmark("SinglyLinkedList, rescan per tick", reps, [&] {
+        SinglyLinkedList<std::uint64_t> ticks;
+        std::uint64_t total = 0;
+        for (std::uint64_t i = 0; i < 300000; ++i) {
+            ticks.push_back((i * 2654435761u) % 100000);
+            if (ticks.size() > window) ticks.pop_front();
+            auto [low, high] = std::minmax_element(ticks.begin(), ticks.end());
+            total += *low + *high;
+        }
+        return total;
+    });
+}
+
+void benchmarkContentHash() {
+    std::cout << "== dedupe 1M lists of 8 keys, 10K distinct ==\n";
+    const int reps = 3;
+    auto dedupe = [](bool tracked) {
+        std::unordered_set<SinglyLinkedList<std::uint64_t>> seen;
+        for (std::uint64_t i = 0; i < 1000000; ++i) {
+            SinglyLinkedList<std::uint64_t> keys;
+            if (tracked) keys.track_hash();
+            for (std::uint64_t j = 0; j < 8; ++j) keys.push_back((i % 10000) * 8 + j);
+            seen.insert(std::move(keys));
+        }
+        return seen.size();
+    };
+    benchmark("tracked rolling hash", reps, [&] { return dedupe(true); });
+    benchmark("hash computed on insert", reps, [&] { return dedupe(false); });
+
+    std::cout << "== compare 1M pairs of 64-key lists differing at the end ==\n";
+    auto pairs = [](bool tracked) {
+        std::vector<SinglyLinkedList<std::uint64_t>> lists(2000);
+        for (std::size_t l = 0; l < lists.size(); ++l) {
+            if (tracked) lists[l].track_hash();
+            for (std::uint64_t j = 0; j < 63; ++j) lists[l].push_back(j);
+            lists[l].push_back(l);
+        }
+        return lists;
+    };
+    for (bool tracked : {true, false}) {
+        auto lists = pairs(tracked);
+        benchmark(tracked ? "operator==, tracked hashes" : "operator==, element walk", reps, [&] {
+            std::uint64_t equal = 0;
+            for (std::size_t i = 0; i < 1000000; ++i) equal += lists[i % 2000] == lists[(i * 7 + 1) % 2000];
+            return equal;
+        });
+    }
+}
+
+void benchmarkComparison() {
+    std::cout << "== compare 1M-element lists, 100 times ==\n";
+    const int reps = 3;
+    SinglyLinkedList<std::uint64_t> original;
+    for (std::uint64_t i = 0; i < 1000000; ++i) original.push_back(i);
+    SinglyLinkedList<std::uint64_t> alias;
+    alias = original;
+    SinglyLinkedList<std::uint64_t> deep(original);
+    benchmark("operator==, aliasing copy", reps, [&] {
+        std::uint64_t equal = 0;
+        for (int i = 0; i < 100; ++i) equal += alias == original;
+        return equal;
+    });
+    benchmark("operator==, deep copy", reps, [&] {
+        std::uint64_t equal = 0;
+        for (int i = 0; i < 100; ++i) equal += deep == original;
+        return equal;
+    });
+    std::vector<std::uint64_t> values(original.begin(), original.end());
+    CompressedIntList<std::uint64_t> packed(values.begin(), values.end());
+    values.back() = 0;
+    CompressedIntList<std::uint64_t> packedChanged(values.begin(), values.end());
+    benchmark("CompressedIntList <=>, memcmp per block", reps, [&] {
+        std::uint64_t less = 0;
+        for (int i = 0; i < 100; ++i) less += (packedChanged <=> packed) < 0;
+        return less;
+    });
+    benchmark("CompressedIntList, decode and compare", reps, [&] {
+        std::uint64_t less = 0;
+        for (int i = 0; i < 100; ++i) less += packedChanged.to_vector() < packed.to_vector();
+        return less;
+    });
+}
+
+void benchmarkHandles() {
+    std::cout << "== replace the entry after one of 5000 held positions, 20K times ==\n";
+    const int reps = 3;
+    const std::size_t anchors = 5000;
+    benchmark("HandleList, erase_after/insert_after", reps, [&] {
+        HandleList<std::uint64_t> table;
+        std::vector<NodeHandle> held;
+        for (std::size_t i = 0; i < anchors; ++i) {
+            held.push_back(table.push_back(0));
+            table.push_back(i);
+        }
+        for (std::uint64_t step = 0; step < 20000; ++step) {
+            NodeHandle at = held[(step * 2654435761u) % anchors];
+            table.erase_after(at);
+            table.insert_after(at, step);
+        }
+        std::uint64_t total = 0;
+        for (std::uint64_t value : table) total += value;
+        return total;
+    });
+    benchmark("SinglyLinkedList, erase_before/insert_before", reps, [&] {
+        SinglyLinkedList<std::uint64_t> table;
+        for (std::size_t i = 0; i < anchors; ++i) {
+            table.push_back(0);
+            table.push_back(i);
+        }
+        table.push_back(0);
+        std::vector<decltype(table.begin().current)> held;
+        std::size_t position = 0;
+        for (auto it = table.begin(); it != table.end(); ++it, ++position) {
+            if (position % 2 == 0) held.push_back(it.current);
+        }
+        for (std::uint64_t step = 0; step < 20000; ++step) {
+            auto next = held[(step * 2654435761u) % anchors + 1];
+            table.erase_before(next);
+            table.insert_before(next, step);
+        }
+        std::uint64_t total = 0;
+        for (std::uint64_t value : table) total += value;
+        return total;
+    });
+}
+
+int main() {
+    benchmarkPipeline();
+    benchmarkCrossThreadQueue();
+    benchmarkHugePages();
+    benchmarkSort();
+    benchmarkTopK();
+    benchmarkIntersection();
+    benchmarkMergeK();
+    benchmarkPartition();
+    benchmarkAggregates();
+    benchmarkMonotonicQueue();
+    benchmarkContentHash();
+    benchmarkComparison();
+    benchmarkHandles();
+    return 0;
+}
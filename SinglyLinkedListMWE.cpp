@@ -2,6 +2,26 @@
 #include <iostream>
 #include <cassert>
 #include <queue>
+#include <string>
+#include <unordered_set>
+#include <atomic>
+
+// Counts the allocations made through it, to check which allocator nodes come from.
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+    std::size_t* count;
+    explicit CountingAllocator(std::size_t* counter) : count(counter) {}
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>& other) : count(other.count) {}
+    T* allocate(std::size_t n) {
+        ++*count;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+    template<typename U>
+    bool operator==(const CountingAllocator<U>& other) const { return count == other.count; }
+};
 
 int main() {
     std::cout << "MWE test starts!\n";
@@ -84,6 +104,525 @@ int main() {
     assert(myQueue.size() == 2);
     std::cout << "10\n";
 
+    // Test destruction of a long list without recursion
+    {
+        SinglyLinkedList<int> longList;
+        for (int i = 0; i < 1000000; ++i) longList.push_back(i);
+        longList.clear();
+        assert(longList.empty());
+        for (int i = 0; i < 1000000; ++i) longList.push_back(i);
+    }
+    std::cout << "11\n";
+
+    // Test asynchronous release
+    SinglyLinkedList<int> asyncList;
+    for (int i = 0; i < 100000; ++i) asyncList.push_back(i);
+    SinglyLinkedList<int> alias;
+    alias = asyncList;
+    std::future<void> released = asyncList.release_async();
+    assert(asyncList.empty() && asyncList.size() == 0);
+    released.wait();
+    assert(alias.size() == 100000 && alias.back() == 99999);
+    alias.clear_async();
+    assert(alias.empty());
+    asyncList.push_back(1);
+    assert(asyncList.front() == 1);
+    AsyncReclaimer::instance().wait_idle();
+    assert(AsyncReclaimer::instance().pending() == 0);
+    std::cout << "12\n";
+
+    // Test bulk pop and drain operations
+    SinglyLinkedList<int> batch = {1, 2, 3, 4, 5, 6, 7};
+    std::vector<int> popped;
+    batch.pop_front_n(3, std::back_inserter(popped));
+    assert((popped == std::vector<int>{1, 2, 3}));
+    assert(batch.size() == 4 && batch.front() == 4 && batch.back() == 7);
+    SinglyLinkedList<int> prefix = batch.take_front(2);
+    assert((prefix == SinglyLinkedList<int>{4, 5}));
+    assert(prefix.back() == 5);
+    assert((batch == SinglyLinkedList<int>{6, 7}));
+    prefix.push_back(9);
+    assert(prefix.size() == 3 && prefix.back() == 9);
+    assert(batch.drain_into(popped) == 2);
+    assert((popped == std::vector<int>{1, 2, 3, 6, 7}));
+    assert(batch.empty() && batch.size() == 0);
+    batch.push_back(8);
+    assert(batch.front() == 8 && batch.back() == 8);
+    SinglyLinkedList<int> whole = prefix.take_front(10);
+    assert(prefix.empty() && whole.size() == 3);
+    int out[4] = {0, 0, 0, 0};
+    assert(prefix.pop_front_n(5, out) == out);
+    assert(whole.pop_front_n(5, out) == out + 3);
+    assert(out[0] == 4 && out[2] == 9 && whole.empty());
+    std::cout << "13\n";
+
+    // Test single-pass removal operations
+    SinglyLinkedList<int> filterList = {1, 2, 2, 3, 4, 4, 4, 5, 6};
+    assert(filterList.remove_if([](int x) { return x % 2 == 1; }) == 3);
+    assert((filterList == SinglyLinkedList<int>{2, 2, 4, 4, 4, 6}));
+    assert(filterList.back() == 6);
+    assert(filterList.unique() == 3);
+    assert((filterList == SinglyLinkedList<int>{2, 4, 6}));
+    assert(filterList.remove(6) == 1);
+    assert(filterList.back() == 4 && filterList.size() == 2);
+    filterList.push_back(7);
+    assert((filterList == SinglyLinkedList<int>{2, 4, 7}));
+    assert(filterList.remove_if([](int) { return true; }) == 3);
+    assert(filterList.empty() && filterList.size() == 0);
+    filterList.push_back(1);
+    assert(filterList.front() == 1 && filterList.back() == 1);
+    SinglyLinkedList<int> near = {1, 2, 4, 5, 9, 10};
+    assert(near.unique([](int a, int b) { return b - a == 1; }) == 3);
+    assert((near == SinglyLinkedList<int>{1, 4, 9}));
+    std::cout << "14\n";
+
+    // Test positional insert and erase after an iterator
+    SinglyLinkedList<int> positional = {1, 2, 3, 4, 5};
+    auto second = std::next(positional.begin());
+    assert(positional.erase_after(second, std::next(second, 3)) == 2);
+    assert((positional == SinglyLinkedList<int>{1, 2, 5}));
+    assert(positional.erase_after(second, positional.end()) == 1);
+    assert(positional.back() == 2 && positional.size() == 2);
+    positional.insert_after(second, 3);
+    assert(positional.back() == 3);
+    assert(*positional.erase_after(positional.begin()) == 3);
+    assert((positional == SinglyLinkedList<int>{1, 3}));
+    bool eraseThrown = false;
+    try {
+        positional.erase_after(std::next(positional.begin()));
+    } catch (const std::runtime_error&) {
+        eraseThrown = true;
+    }
+    assert(eraseThrown);
+    std::cout << "15\n";
+
+    // Test applying a batch of positional edits
+    using Edit = SinglyLinkedList<int>::Edit;
+    SinglyLinkedList<int> edited = {10, 20, 30, 40, 50};
+    std::vector<Edit> edits = {Edit::erase(4), Edit::insert(0, 5), Edit::replace(2, 33), Edit::insert(5, 60),
+                               Edit::erase(1), Edit::insert(2, 25), Edit::insert(2, 26)};
+    edited.apply_edits(edits);
+    assert((edited == SinglyLinkedList<int>{5, 10, 25, 26, 33, 40, 60}));
+    assert(edited.back() == 60 && edited.size() == 7);
+    std::vector<Edit> tailErase = {Edit::erase(6), Edit::erase(5)};
+    edited.apply_edits(tailErase);
+    assert(edited.back() == 33 && edited.size() == 5);
+    edited.push_back(34);
+    assert(edited.back() == 34);
+    std::vector<Edit> badEdits = {Edit::replace(1, 0), Edit::erase(1)};
+    bool editThrown = false;
+    try {
+        edited.apply_edits(badEdits);
+    } catch (const std::runtime_error&) {
+        editThrown = true;
+    }
+    assert(editThrown && edited.size() == 6);
+    std::vector<Edit> rangeEdits = {Edit::insert(7, 1)};
+    editThrown = false;
+    try {
+        edited.apply_edits(rangeEdits);
+    } catch (const std::out_of_range&) {
+        editThrown = true;
+    }
+    assert(editThrown);
+    SinglyLinkedList<int> fromEmpty;
+    std::vector<Edit> appends = {Edit::insert(0, 1), Edit::insert(0, 2)};
+    fromEmpty.apply_edits(appends);
+    assert((fromEmpty == SinglyLinkedList<int>{1, 2}) && fromEmpty.back() == 2);
+    std::cout << "16\n";
+
+    // Test node reservation and resizing
+    SinglyLinkedList<int> reserved;
+    assert(reserved.capacity() == 0);
+    reserved.reserve(100);
+    assert(reserved.capacity() >= 100);
+    for (int i = 0; i < 100; ++i) reserved.push_back(i);
+    assert(reserved.capacity() == 100 && reserved.size() == 100);
+    reserved.resize(10);
+    assert(reserved.size() == 10 && reserved.back() == 9 && reserved.capacity() == 100);
+    reserved.resize(12, 7);
+    assert(reserved.size() == 12 && reserved.back() == 7 && reserved.get(10) == 7);
+    reserved.resize(14);
+    assert(reserved.back() == 0 && reserved.capacity() == 100);
+    reserved.clear();
+    reserved.shrink_to_fit();
+    assert(reserved.capacity() == 0);
+    reserved.resize(3, 5);
+    assert((reserved == SinglyLinkedList<int>{5, 5, 5}));
+    SinglyLinkedList<int> pooledCopy(reserved);
+    reserved.clear();
+    assert(pooledCopy.size() == 3);
+    std::size_t allocations = 0;
+    SinglyLinkedList<int, CountingAllocator<int>> counted{CountingAllocator<int>(&allocations)};
+    counted.reserve(10);
+    for (int i = 0; i < 10; ++i) counted.push_back(i);
+    assert(allocations == 10 && counted.capacity() == 10);
+    std::cout << "17\n";
+
+    // Test sorting by relinking is stable and keeps the tail usable
+    SinglyLinkedList<std::pair<int, int>> pairs;
+    for (int i = 0; i < 1000; ++i) pairs.push_back({(i * 7919) % 10, i});
+    const std::pair<int, int>* firstNode = &pairs.front();
+    pairs.sort([](const auto& a, const auto& b) { return a.first < b.first; });
+    bool stable = true;
+    for (auto it = pairs.begin(), next = std::next(it); next != pairs.end(); ++it, ++next) {
+        stable = stable && (it->first < next->first || (it->first == next->first && it->second < next->second));
+    }
+    assert(stable && pairs.size() == 1000 && pairs.back().first == 9);
+    assert(&pairs.front() == firstNode);
+    pairs.push_back({10, 0});
+    assert(pairs.back().first == 10);
+    SinglyLinkedList<int> descending = {3, 1, 2};
+    descending.sort(std::greater<>());
+    assert((descending == SinglyLinkedList<int>{3, 2, 1}));
+    descending.sort();
+    assert((descending == SinglyLinkedList<int>{1, 2, 3}) && descending.back() == 3);
+    editThrown = false;
+    try {
+        descending.sort([](int, int) -> bool { throw std::runtime_error("comparison failed"); });
+    } catch (const std::runtime_error&) {
+        editThrown = true;
+    }
+    assert(editThrown && descending.size() == 3);
+    descending.push_back(4);
+    assert(descending.back() == 4);
+    std::cout << "18\n";
+
+    // Test radix sort on unsigned, signed and floating-point keys
+    SinglyLinkedList<unsigned> ids = {300, 5, 70000, 5, 0, 256};
+    radix_sort(ids, [](unsigned x) { return x; });
+    assert((ids == SinglyLinkedList<unsigned>{0, 5, 5, 256, 300, 70000}) && ids.back() == 70000);
+    SinglyLinkedList<int> offsets = {3, -1, 0, -300, 2147483647, -2147483647 - 1};
+    radix_sort(offsets, [](int x) { return x; });
+    assert((offsets == SinglyLinkedList<int>{-2147483647 - 1, -300, -1, 0, 3, 2147483647}));
+    SinglyLinkedList<double> readings = {2.5, -0.5, 0.0, -7.25, 1e300, -1e-300};
+    radix_sort(readings, [](double x) { return x; });
+    assert((readings == SinglyLinkedList<double>{-7.25, -0.5, -1e-300, 0.0, 2.5, 1e300}));
+    SinglyLinkedList<std::pair<std::int64_t, int>> stamped;
+    for (int i = 0; i < 1000; ++i) stamped.push_back({(i % 4) - 2, i});
+    radix_sort(stamped, [](const auto& p) { return p.first; });
+    bool radixStable = true;
+    for (auto it = stamped.begin(), next = std::next(it); next != stamped.end(); ++it, ++next) {
+        radixStable = radixStable && (it->first < next->first || (it->first == next->first && it->second < next->second));
+    }
+    assert(radixStable && stamped.front().first == -2 && stamped.back().first == 1);
+    stamped.push_back({5, 0});
+    assert(stamped.back().first == 5 && stamped.size() == 1001);
+    SinglyLinkedList<int> unsortable = {3, 1, 2};
+    editThrown = false;
+    try {
+        radix_sort(unsortable, [](int x) -> int { if (x == 2) throw std::runtime_error("no key"); return x; });
+    } catch (const std::runtime_error&) {
+        editThrown = true;
+    }
+    assert(editThrown && (unsortable == SinglyLinkedList<int>{3, 1, 2}) && unsortable.back() == 2);
+    std::cout << "19\n";
+
+    // Test top-k relinks the k smallest to the front in order and keeps the rest in order
+    SinglyLinkedList<int> scores;
+    for (int i = 0; i < 200; ++i) scores.push_back((i * 37) % 200);
+    partial_sort_top_k(scores, 5);
+    assert((scores.take_front(5) == SinglyLinkedList<int>{0, 1, 2, 3, 4}));
+    assert(scores.size() == 195 && scores.front() == 37 && scores.back() == (199 * 37) % 200);
+    SinglyLinkedList<int> largest = {4, 9, 1, 9, 7};
+    partial_sort_top_k(largest, 2, std::greater<>());
+    assert((largest == SinglyLinkedList<int>{9, 9, 4, 1, 7}) && largest.back() == 7);
+    SinglyLinkedList<int> countdown = {5, 4, 3, 2, 1};
+    partial_sort_top_k(countdown, 2);
+    assert((countdown == SinglyLinkedList<int>{1, 2, 5, 4, 3}) && countdown.back() == 3);
+    countdown.push_back(0);
+    assert(countdown.size() == 6 && countdown.back() == 0);
+    partial_sort_top_k(largest, 10);
+    assert((largest == SinglyLinkedList<int>{1, 4, 7, 9, 9}));
+    editThrown = false;
+    try {
+        partial_sort_top_k(largest, 2, [](int, int) -> bool { throw std::runtime_error("comparison failed"); });
+    } catch (const std::runtime_error&) {
+        editThrown = true;
+    }
+    assert(editThrown && (largest == SinglyLinkedList<int>{1, 4, 7, 9, 9}));
+    std::cout << "20\n";
+
+    // Test nth_element places the nth element and partitions around it
+    SinglyLinkedList<int> samples;
+    for (int i = 0; i < 1001; ++i) samples.push_back((i * 7919) % 1001 / 3);
+    std::vector<int> ordered = samples.to_vector();
+    std::sort(ordered.begin(), ordered.end());
+    for (std::size_t n : {std::size_t(0), std::size_t(500), std::size_t(1000)}) {
+        int& nth = nth_element(samples, n);
+        assert(nth == ordered[n] && samples.get(n) == ordered[n] && samples.size() == 1001);
+        std::size_t index = 0;
+        for (int x : samples) {
+            assert(index < n ? x <= nth : index > n ? x >= nth : true);
+            ++index;
+        }
+    }
+    samples.push_back(-1);
+    assert(samples.back() == -1);
+    editThrown = false;
+    try {
+        nth_element(samples, 1002);
+    } catch (const std::out_of_range&) {
+        editThrown = true;
+    }
+    assert(editThrown);
+    editThrown = false;
+    int calls = 0;
+    try {
+        nth_element(samples, 10, [&calls](int a, int b) { if (++calls == 500) throw std::runtime_error("comparison failed"); return a < b; });
+    } catch (const std::runtime_error&) {
+        editThrown = true;
+    }
+    std::vector<int> kept = samples.to_vector();
+    std::sort(kept.begin(), kept.end());
+    ordered.insert(ordered.begin(), -1);
+    assert(editThrown && kept == ordered && samples.size() == 1002);
+    std::cout << "21\n";
+
+    // Test set operations on sorted lists, copying and relinking
+    SinglyLinkedList<unsigned> postingA = {1, 3, 3, 5, 8, 13};
+    SinglyLinkedList<unsigned> postingB = {2, 3, 5, 5, 13, 21};
+    assert((set_union(postingA, postingB) == SinglyLinkedList<unsigned>{1, 2, 3, 3, 5, 5, 8, 13, 21}));
+    assert((set_intersection(postingA, postingB) == SinglyLinkedList<unsigned>{3, 5, 13}));
+    assert((set_difference(postingA, postingB) == SinglyLinkedList<unsigned>{1, 3, 8}));
+    assert(postingA.size() == 6 && postingB.size() == 6);
+    const unsigned* firstPosting = &postingA.front();
+    SinglyLinkedList<unsigned> relinked = set_union(std::move(postingA), std::move(postingB));
+    assert((relinked == SinglyLinkedList<unsigned>{1, 2, 3, 3, 5, 5, 8, 13, 21}) && relinked.back() == 21);
+    assert(&relinked.front() == firstPosting && postingA.empty() && postingB.empty());
+    SinglyLinkedList<unsigned> common = set_intersection(SinglyLinkedList<unsigned>{9, 7, 5, 1}, SinglyLinkedList<unsigned>{8, 7, 1}, std::greater<>());
+    assert((common == SinglyLinkedList<unsigned>{7, 1}) && common.back() == 1);
+    SinglyLinkedList<unsigned> remaining = set_difference(SinglyLinkedList<unsigned>{1, 2, 4}, SinglyLinkedList<unsigned>{2, 3});
+    assert((remaining == SinglyLinkedList<unsigned>{1, 4}) && remaining.back() == 4);
+    remaining.push_back(6);
+    assert(remaining.size() == 3);
+    std::cout << "22\n";
+
+    // Test intersection through a skip index against the plain merge
+    SinglyLinkedList<unsigned> longPostings;
+    for (unsigned i = 0; i < 100000; ++i) longPostings.push_back(i * 3 + (i % 7 == 0 ? 1 : 0));
+    SinglyLinkedList<unsigned> shortPostings = {0, 1, 2, 3, 4, 3000, 3001, 150000, 150003, 299997, 299998, 400000};
+    for (std::size_t stride : {std::size_t(1), std::size_t(7), std::size_t(64), std::size_t(100000)}) {
+        SinglyLinkedList<unsigned>::SkipIndex index(longPostings, stride);
+        assert(set_intersection(shortPostings, index) == set_intersection(shortPostings, longPostings));
+    }
+    SinglyLinkedList<unsigned> duplicates = {5, 5, 5};
+    SinglyLinkedList<unsigned> twice = {1, 5, 5, 9};
+    SinglyLinkedList<unsigned>::SkipIndex twiceIndex(twice, 2);
+    assert((set_intersection(duplicates, twiceIndex) == SinglyLinkedList<unsigned>{5, 5}));
+    SinglyLinkedList<unsigned> nothing;
+    assert(set_intersection(duplicates, SinglyLinkedList<unsigned>::SkipIndex(nothing)).empty());
+    std::cout << "23\n";
+
+    // Test k-way merge relinks every node into one stable sorted list
+    std::vector<SinglyLinkedList<std::pair<int, int>>> shards(7);
+    for (int i = 0; i < 7000; ++i) shards[static_cast<std::size_t>(i % 7)].push_back({(i * 31) % 500, i % 7});
+    for (auto& shard : shards) shard.sort([](const auto& a, const auto& b) { return a.first < b.first; });
+    const std::pair<int, int>* shardNode = &shards[3].front();
+    auto byKey = [](const auto& a, const auto& b) { return a.first < b.first; };
+    SinglyLinkedList<std::pair<int, int>> mergedShards = merge_k(std::span(shards), byKey);
+    assert(mergedShards.size() == 7000 && mergedShards.back().first == 499);
+    bool mergeStable = true;
+    bool sawShardNode = false;
+    for (auto it = mergedShards.begin(), next = std::next(it); next != mergedShards.end(); ++it, ++next) {
+        mergeStable = mergeStable && (it->first < next->first || (it->first == next->first && it->second <= next->second));
+        sawShardNode = sawShardNode || &*it == shardNode;
+    }
+    assert(mergeStable && sawShardNode);
+    for (const auto& shard : shards) assert(shard.empty());
+    std::vector<SinglyLinkedList<int>> uneven = {{5}, {}, {1, 2, 9}, {3, 4}};
+    assert((merge_k(std::span(uneven)) == SinglyLinkedList<int>{1, 2, 3, 4, 5, 9}));
+    std::vector<SinglyLinkedList<int>> none;
+    assert(merge_k(std::span(none)).empty());
+    std::vector<SinglyLinkedList<int>> failing = {{1, 4, 7}, {2, 5, 8}, {3, 6, 9}};
+    int mergeCalls = 0;
+    editThrown = false;
+    try {
+        merge_k(std::span(failing), [&mergeCalls](int a, int b) { if (++mergeCalls == 12) throw std::runtime_error("comparison failed"); return a < b; });
+    } catch (const std::runtime_error&) {
+        editThrown = true;
+    }
+    std::size_t keptNodes = 0;
+    for (auto& list : failing) {
+        keptNodes += list.size();
+        if (!list.empty()) list.push_back(0);
+    }
+    assert(editThrown && keptNodes == 9);
+    std::cout << "24\n";
+
+    // Test the parallel merge matches the sequential one
+    std::vector<SinglyLinkedList<int>> many(64), same(64);
+    for (int i = 0; i < 100000; ++i) {
+        many[static_cast<std::size_t>(i % 64)].push_back(i / 64 + (i % 64) * 13);
+        same[static_cast<std::size_t>(i % 64)].push_back(i / 64 + (i % 64) * 13);
+    }
+    SinglyLinkedList<int> parallel = merge_k(std::span(many), std::less<>(), 4);
+    SinglyLinkedList<int> sequential = merge_k(std::span(same));
+    assert(parallel.size() == 100000 && parallel == sequential && parallel.back() == sequential.back());
+    parallel.push_back(1 << 30);
+    assert(parallel.size() == 100001);
+    for (int i = 0; i < 100000; ++i) same[static_cast<std::size_t>(i % 64)].push_back(i / 64 + (i % 64) * 13);
+    std::atomic<int> parallelCalls = 0;
+    editThrown = false;
+    try {
+        merge_k(std::span(same), [&parallelCalls](int a, int b) {
+            if (++parallelCalls == 20000) throw std::runtime_error("comparison failed");
+            return a < b;
+        }, 4);
+    } catch (const std::runtime_error&) {
+        editThrown = true;
+    }
+    keptNodes = 0;
+    for (auto& list : same) keptNodes += list.size();
+    assert(editThrown && keptNodes == 100000);
+    std::cout << "25\n";
+
+    // Test partition_into, gather and splice_back
+    SinglyLinkedList<int> toShard;
+    for (int i = 0; i < 1000; ++i) toShard.push_back(i);
+    const int* shardedNode = &toShard.front();
+    std::vector<SinglyLinkedList<int>> parts = partition_into(toShard, 7, [](int x) { return x; });
+    assert(toShard.empty() && parts.size() == 7);
+    std::size_t partTotal = 0;
+    for (std::size_t b = 0; b < parts.size(); ++b) {
+        partTotal += parts[b].size();
+        assert(std::is_sorted(parts[b].begin(), parts[b].end()));
+        for (int x : parts[b]) assert(std::hash<int>()(x) % 7 == b);
+        parts[b].push_back(-1);
+        assert(parts[b].back() == -1);
+        parts[b].pop_back();
+    }
+    assert(partTotal == 1000);
+    SinglyLinkedList<int> gathered = gather(std::span(parts));
+    assert(gathered.size() == 1000);
+    for (const auto& part : parts) assert(part.empty());
+    bool sawFirstNode = false;
+    for (const int& x : gathered) sawFirstNode = sawFirstNode || &x == shardedNode;
+    assert(sawFirstNode);
+    gathered.sort();
+    assert(gathered.front() == 0 && gathered.back() == 999);
+    SinglyLinkedList<int> spliced = {1, 2};
+    SinglyLinkedList<int> spliceTail = {3, 4};
+    spliced.splice_back(spliceTail);
+    spliced.splice_back(spliced);
+    assert((spliced == SinglyLinkedList<int>{1, 2, 3, 4}) && spliceTail.empty() && spliced.back() == 4);
+    spliceTail.push_back(5);
+    assert(spliceTail.size() == 1 && spliced.size() == 4);
+    SinglyLinkedList<int> unsharded = {1, 2, 3, 4, 5};
+    editThrown = false;
+    try {
+        partition_into(unsharded, 3, [](int x) { if (x == 4) throw std::runtime_error("key failed"); return x; });
+    } catch (const std::runtime_error&) {
+        editThrown = true;
+    }
+    assert(editThrown && unsharded.size() == 5);
+    unsharded.sort();
+    assert((unsharded == SinglyLinkedList<int>{1, 2, 3, 4, 5}) && unsharded.back() == 5);
+    editThrown = false;
+    try {
+        partition_into(unsharded, 0, [](int x) { return x; });
+    } catch (const std::invalid_argument&) {
+        editThrown = true;
+    }
+    assert(editThrown);
+    std::cout << "26\n";
+
+    // Test the rolling content hash and hashing lists into unordered containers
+    SinglyLinkedList<int> rolled;
+    rolled.track_hash();
+    for (int i = 0; i < 100; ++i) rolled.push_back(i);
+    rolled.push_front(-1);
+    rolled.pop_front();
+    rolled.pop_front();
+    rolled.pop_back();
+    rolled.push_back(99);
+    SinglyLinkedList<int> fresh;
+    for (int i = 1; i < 100; ++i) fresh.push_back(i);
+    assert(rolled.content_hash() == fresh.content_hash());
+    assert(rolled == fresh && std::hash<SinglyLinkedList<int>>()(rolled) == std::hash<SinglyLinkedList<int>>()(fresh));
+    SinglyLinkedList<int> other = {1, 2, 3};
+    SinglyLinkedList<int> swapped = {1, 3, 2};
+    other.track_hash();
+    swapped.track_hash();
+    assert(other.content_hash() != swapped.content_hash() && other != swapped);
+    swapped.sort();
+    assert(other.content_hash() == swapped.content_hash() && other == swapped);
+    rolled.remove_if([](int x) { return x % 2 == 0; });
+    fresh.remove_if([](int x) { return x % 2 == 0; });
+    assert(rolled.content_hash() == fresh.content_hash() && rolled.size() == 50);
+    SinglyLinkedList<int> moved = std::move(rolled);
+    moved.push_back(7);
+    fresh.push_back(7);
+    assert(moved.content_hash() == fresh.content_hash());
+    moved.clear();
+    moved.push_back(5);
+    assert(moved.content_hash() == SinglyLinkedList<int>{5}.content_hash());
+    moved.front() = 6;
+    assert(moved.content_hash() == SinglyLinkedList<int>{6}.content_hash());
+    SinglyLinkedList<int> written = {0, 2, 3};
+    SinglyLinkedList<int> target = {1, 2, 4};
+    written.track_hash();
+    target.track_hash();
+    written.front() = 1;
+    *std::next(written.begin(), 2) = 4;
+    assert(written == target && written.content_hash() == target.content_hash());
+    written.get(1) = 5;
+    target.track_hash();
+    assert(written != target);
+    written.track_hash();
+    *std::next(written.begin()) = 2;
+    assert(written == target);
+    static_assert(sizeof(SinglyLinkedList<int>::Iterator) == sizeof(void*));
+    SinglyLinkedList<int> aliased;
+    aliased = target;
+    aliased.front() = 9;
+    SinglyLinkedList<int> expected = {9, 2, 4};
+    expected.track_hash();
+    assert(target == expected && target.content_hash() == expected.content_hash());
+    std::unordered_set<SinglyLinkedList<std::string>> seen;
+    for (int i = 0; i < 1000; ++i) {
+        SinglyLinkedList<std::string> words;
+        words.track_hash();
+        words.push_back(std::to_string(i % 10));
+        words.push_back(std::to_string(i % 7));
+        seen.insert(std::move(words));
+    }
+    assert(seen.size() == 70);
+    assert(seen.count(SinglyLinkedList<std::string>{"3", "3"}) == 1 && seen.count(SinglyLinkedList<std::string>{"3"}) == 0);
+    std::cout << "27\n";
+
+    // Test equality and three-way comparison, including lists sharing nodes
+    SinglyLinkedList<int> shared = {1, 2, 3, 4};
+    SinglyLinkedList<int> aliasing;
+    aliasing = shared;
+    assert(aliasing == shared && (aliasing <=> shared) == 0);
+    aliasing.pop_front();
+    SinglyLinkedList<int> suffix = {9, 2, 3, 4};
+    suffix.pop_front();
+    assert(aliasing == suffix && (aliasing <=> suffix) == 0);
+    SinglyLinkedList<int> extended = {1, 2, 3};
+    SinglyLinkedList<int> aliasedPrefix;
+    aliasedPrefix = extended;
+    extended.push_back(4);
+    SinglyLinkedList<int> equalToAliasedPrefix = {1, 2, 3};
+    assert(aliasedPrefix.size() == 3 && aliasedPrefix == equalToAliasedPrefix && aliasedPrefix != extended);
+    assert((aliasedPrefix <=> equalToAliasedPrefix) == 0 && (aliasedPrefix <=> extended) < 0 && (extended <=> aliasedPrefix) > 0);
+    assert(((SinglyLinkedList<int>{1, 2} <=> SinglyLinkedList<int>{1, 3}) < 0));
+    assert(((SinglyLinkedList<int>{1, 2, 0} <=> SinglyLinkedList<int>{1, 2}) > 0));
+    assert((SinglyLinkedList<int>{} < SinglyLinkedList<int>{0} && SinglyLinkedList<int>{5} > SinglyLinkedList<int>{4, 9}));
+    assert(((SinglyLinkedList<double>{1.0, 0.0 / 0.0} <=> SinglyLinkedList<double>{1.0, 2.0}) == std::partial_ordering::unordered));
+    struct LessOnly {
+        int key;
+        bool operator<(const LessOnly& other) const { return key < other.key; }
+    };
+    SinglyLinkedList<LessOnly> lessOnly = {{1}, {2}};
+    SinglyLinkedList<LessOnly> lessOnlyOther = {{1}, {3}};
+    assert((lessOnly <=> lessOnlyOther) == std::weak_ordering::less);
+    std::vector<SinglyLinkedList<std::string>> byWords = {{"b"}, {"a", "z"}, {"a"}, {}};
+    std::sort(byWords.begin(), byWords.end());
+    assert(byWords[0].empty() && byWords[1].size() == 1 && byWords[2].back() == "z" && byWords[3].front() == "b");
+    std::cout << "28\n";
+
     std::cout << "All tests passed successfully!" << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef SINGLYLINKEDLISTRANGES_HPP
+#define SINGLYLINKEDLISTRANGES_HPP
+
+#include <ranges>
+#include <utility>
+#include "SinglyLinkedList.hpp"
+
+/**
+ * @brief std::ranges support for SinglyLinkedList.
+ *
+ * SinglyLinkedList models std::ranges::forward_range, so std::views adaptors such as filter,
+ * transform and take compose over it lazily. The sll::to<Container>() adaptor below closes a
+ * pipeline by appending every surviving element to a new container in a single pass:
+ *
+ * @code
+ * auto out = list | std::views::filter(p) | std::views::transform(f) | sll::to<SinglyLinkedList>();
+ * @endcode
+ *
+ * It works on every standard library. Where std::ranges::to is available, it also accepts
+ * SinglyLinkedList, whose deduction guides deduce the element type.
+ */
+
+static_assert(std::ranges::forward_range<SinglyLinkedList<int>>);
+static_assert(std::ranges::forward_range<const SinglyLinkedList<int>>);
+
+namespace sll {
+
+/**
+ * @brief Range adaptor closure that materializes a range into a container template.
+ * @tparam C The container template, instantiated with the range's value type.
+ */
+template<template<typename...> class C>
+struct ToContainerAdaptor {
+    template<std::ranges::input_range R>
+    friend auto operator|(R&& range, ToContainerAdaptor) {
+        C<std::ranges::range_value_t<R>> out;
+        for (auto&& item : range) {
+            out.push_back(std::forward<decltype(item)>(item));
+        }
+        return out;
+    }
+};
+
+/**
+ * @brief Range adaptor closure that materializes a range into a concrete container type.
+ * @tparam C The container type.
+ */
+template<typename C>
+struct ToTypeAdaptor {
+    template<std::ranges::input_range R>
+    friend C operator|(R&& range, ToTypeAdaptor) {
+        C out;
+        for (auto&& item : range) {
+            out.push_back(std::forward<decltype(item)>(item));
+        }
+        return out;
+    }
+};
+
+/**
+ * @brief Creates an adaptor that collects a range into a container template, e.g. sll::to<SinglyLinkedList>().
+ * @return The adaptor closure.
+ */
+template<template<typename...> class C>
+ToContainerAdaptor<C> to() {
+    return {};
+}
+
+/**
+ * @brief Creates an adaptor that collects a range into a container type, e.g. sll::to<SinglyLinkedList<int>>().
+ * @return The adaptor closure.
+ */
+template<typename C>
+ToTypeAdaptor<C> to() {
+    return {};
+}
+
+} // namespace sll
+
+#endif // SINGLYLINKEDLISTRANGES_HPP
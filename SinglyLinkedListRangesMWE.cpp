@@ -0,0 +1,53 @@
+#include "SinglyLinkedListRanges.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <queue>
+#include <type_traits>
+
+int main() {
+    std::cout << "SinglyLinkedList ranges MWE test starts!\n";
+
+    // Test a fused filter/transform pipeline into a new list
+    SinglyLinkedList<int> list = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto squares = list | std::views::filter([](int x) { return x % 2 == 0; })
+                        | std::views::transform([](int x) { return x * x; })
+                        | sll::to<SinglyLinkedList>();
+    assert((squares == SinglyLinkedList<int>{4, 16, 36, 64, 100}));
+    std::cout << "0\n";
+
+    // Test pipelines over const lists and into other containers
+    const SinglyLinkedList<int>& constList = list;
+    auto names = constList | std::views::take(3)
+                           | std::views::transform([](int x) { return std::to_string(x); })
+                           | sll::to<std::vector>();
+    assert((names == std::vector<std::string>{"1", "2", "3"}));
+    auto typed = constList | std::views::drop(8) | sll::to<SinglyLinkedList<int>>();
+    assert(typed.size() == 2 && typed.front() == 9);
+    SinglyLinkedList deduced(names.begin(), names.end());
+    static_assert(std::is_same_v<decltype(deduced), SinglyLinkedList<std::string>>);
+    assert(deduced.size() == 3 && deduced.back() == "3");
+    std::cout << "1\n";
+
+    // Test move-only values and in-place construction
+    SinglyLinkedList<std::string> strings;
+    std::string moved = "moved";
+    strings.push_back(std::move(moved));
+    strings.emplace_back(3, 'x');
+    assert(strings.front() == "moved");
+    assert(strings.back() == "xxx");
+    std::queue<std::string, SinglyLinkedList<std::string>> queue;
+    queue.push("a");
+    queue.emplace("b");
+    assert(queue.front() == "a" && queue.back() == "b");
+    std::cout << "2\n";
+
+    // Test standard range algorithms
+    assert(std::ranges::find(list, 7) != list.end());
+    assert(std::ranges::count_if(list, [](int x) { return x > 5; }) == 5);
+    std::cout << "3\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,129 @@
+#ifndef SPILLFILE_HPP
+#define SPILLFILE_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <unistd.h>
+
+/**
+ * @brief An anonymous temporary file holding blocks of trivially copyable values.
+ *
+ * Values are appended and read back in large sequential blocks with their in-memory
+ * representation, so the file is only meaningful to the process that wrote it. The file is
+ * unlinked on creation and disappears with the object or the process.
+ *
+ * @tparam T Type of values stored; must be trivially copyable.
+ */
+template<typename T>
+class SpillFile {
+    static_assert(std::is_trivially_copyable_v<T>, "SpillFile requires a trivially copyable type.");
+
+public:
+    /**
+     * @brief Creates the temporary file.
+     * @param directory The directory to create it in; the system temp directory if empty.
+     * @throws std::runtime_error if the file cannot be created.
+     */
+    explicit SpillFile(const std::string& directory = "") : file(nullptr), length(0) {
+        if (directory.empty()) {
+            file = std::tmpfile();
+        } else {
+            std::string path = directory + "/spill-XXXXXX";
+            int fd = mkstemp(path.data());
+            if (fd >= 0) {
+                unlink(path.c_str());
+                file = fdopen(fd, "w+b");
+                if (!file) close(fd);
+            }
+        }
+        if (!file) throw std::runtime_error("Cannot create spill file.");
+    }
+
+    SpillFile(const SpillFile&) = delete;
+    SpillFile& operator=(const SpillFile&) = delete;
+
+    ~SpillFile() {
+        std::fclose(file);
+    }
+
+    /**
+     * @brief Gets the number of values written since creation or the last reset().
+     * @return The length of the file in values.
+     */
+    std::size_t size() const { return length; }
+
+    /**
+     * @brief Appends a block of values at the end of the file.
+     * @param data Pointer to the values.
+     * @param count The number of values.
+     * @return The position of the first value, to pass to read().
+     * @throws std::runtime_error if the write fails, e.g. because the disk is full.
+     */
+    std::size_t append(const T* data, std::size_t count) {
+        std::size_t position = length;
+        write(position, data, count);
+        return position;
+    }
+
+    /**
+     * @brief Overwrites a block of values, extending the file if the block ends past it.
+     * @param position The position of the first value; at most size().
+     * @param data Pointer to the values.
+     * @param count The number of values.
+     * @throws std::runtime_error if the position is past the end or the write fails.
+     */
+    void write(std::size_t position, const T* data, std::size_t count) {
+        if (position > length
+            || std::fseek(file, static_cast<long>(position * sizeof(T)), SEEK_SET) != 0
+            || std::fwrite(data, sizeof(T), count, file) != count) {
+            throw std::runtime_error("Spill file write failed.");
+        }
+        length = std::max(length, position + count);
+    }
+
+    /**
+     * @brief Reads a block of values back.
+     * @param position The position returned by append().
+     * @param out Destination for the values.
+     * @param count The number of values to read.
+     * @throws std::runtime_error if the values cannot be read.
+     */
+    void read(std::size_t position, T* out, std::size_t count) {
+        if (position + count > length || std::fflush(file) != 0
+            || std::fseek(file, static_cast<long>(position * sizeof(T)), SEEK_SET) != 0
+            || std::fread(out, sizeof(T), count, file) != count) {
+            throw std::runtime_error("Spill file read failed.");
+        }
+    }
+
+    /**
+     * @brief Reads a block of values back into a vector.
+     * @param position The position returned by append().
+     * @param count The number of values to read.
+     * @return The values.
+     */
+    std::vector<T> read(std::size_t position, std::size_t count) {
+        std::vector<T> values(count);
+        read(position, values.data(), count);
+        return values;
+    }
+
+    /**
+     * @brief Discards every value and gives the disk space back.
+     */
+    void reset() {
+        std::fflush(file);
+        if (ftruncate(fileno(file), 0) == 0) length = 0;
+    }
+
+private:
+    std::FILE* file; //!< The open, already unlinked file.
+    std::size_t length; //!< Number of values written.
+};
+
+#endif // SPILLFILE_HPP
@@ -0,0 +1,298 @@
+#ifndef SPILLINGLIST_HPP
+#define SPILLINGLIST_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "SinglyLinkedList.hpp"
+#include "SpillFile.hpp"
+
+/**
+ * @brief A FIFO list that keeps its hot ends in memory and spills cold middle segments to disk.
+ *
+ * Elements are stored in fixed-size segments linked in a SinglyLinkedList. push_back() fills the
+ * last segment and pop_front() drains the first, so both ends always stay in memory. When a
+ * segment fills up and a fresh one would exceed the memory budget, the full one is written to a
+ * temporary file in one sequential block and its memory is released. A spilled segment is read
+ * back when pop_front() or an iterator reaches it. Every spilled segment is full, so the file
+ * is divided into segment-sized extents, and the extent of a segment read back is reused by the
+ * next spill. The file thus never holds more extents than the most segments spilled at once,
+ * even under a backlog that never drains, and it is truncated once nothing is spilled.
+ *
+ * @tparam T Type of elements stored in the list; must be trivially copyable.
+ */
+template<typename T>
+class SpillingList {
+    static_assert(std::is_trivially_copyable_v<T>, "SpillingList requires a trivially copyable type.");
+
+private:
+    /**
+     * @brief A block of consecutive elements, in memory or in the spill file.
+     */
+    struct Segment {
+        std::vector<T> values; //!< The elements, empty while spilled.
+        std::size_t begin = 0; //!< Number of elements already popped from the front.
+        std::size_t count = 0; //!< Number of elements, including popped ones.
+        std::size_t position = 0; //!< Position in the spill file while spilled.
+        bool spilled = false; //!< Whether the elements are in the spill file.
+    };
+
+    SinglyLinkedList<Segment> segments; //!< The segments, front to back.
+    std::size_t segment_size; //!< Number of elements per segment.
+    std::size_t budget_segments; //!< Number of segments allowed in memory.
+    std::size_t resident; //!< Number of segments currently in memory.
+    std::size_t spilled_segments; //!< Number of segments currently in the spill file.
+    std::size_t list_size; //!< Number of elements in the list.
+    std::string directory; //!< Directory for the spill file.
+    std::unique_ptr<SpillFile<T>> file; //!< The spill file, created on first spill.
+    std::vector<std::size_t> free_extents; //!< Positions of file extents whose segment was read back.
+
+    void load(Segment& segment) {
+        segment.values = file->read(segment.position, segment.count);
+        segment.spilled = false;
+        ++resident;
+        if (--spilled_segments == 0) {
+            file->reset();
+            free_extents.clear();
+        } else {
+            free_extents.push_back(segment.position);
+        }
+    }
+
+    void spill(Segment& segment) {
+        if (!file) file = std::make_unique<SpillFile<T>>(directory);
+        // Room for every extent of the file, so that load() never allocates.
+        free_extents.reserve(file->size() / segment_size + 1);
+        if (free_extents.empty()) {
+            segment.position = file->append(segment.values.data(), segment.count);
+        } else {
+            file->write(free_extents.back(), segment.values.data(), segment.count);
+            segment.position = free_extents.back();
+            free_extents.pop_back();
+        }
+        std::vector<T>().swap(segment.values);
+        segment.spilled = true;
+        --resident;
+        ++spilled_segments;
+    }
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an empty SpillingList.
+     * @param memoryBudget The number of bytes of elements to keep in memory; the two hot end
+     *        segments always stay in memory even if they exceed it.
+     * @param segmentSize The number of elements per segment, i.e. per spilled block.
+     * @param spillDirectory The directory for the spill file; the system temp directory if empty.
+     */
+    explicit SpillingList(std::size_t memoryBudget, std::size_t segmentSize = 65536, const std::string& spillDirectory = "")
+        : segment_size(std::max<std::size_t>(segmentSize, 1)),
+          budget_segments(std::max<std::size_t>(memoryBudget / (sizeof(T) * std::max<std::size_t>(segmentSize, 1)), 2)),
+          resident(0), spilled_segments(0), list_size(0), directory(spillDirectory) {}
+
+    SpillingList(const SpillingList&) = delete;
+    SpillingList& operator=(const SpillingList&) = delete;
+
+    /**
+     * @brief Checks if the list is empty.
+     * @return True if the list is empty, false otherwise.
+     */
+    bool empty() const { return list_size == 0; }
+
+    /**
+     * @brief Gets the size of the list.
+     * @return The number of elements in the list.
+     */
+    std::size_t size() const { return list_size; }
+
+    /**
+     * @brief Gets the number of elements currently spilled to disk.
+     * @return The number of spilled elements.
+     */
+    std::size_t spilled_size() const { return spilled_segments * segment_size; }
+
+    /**
+     * @brief Gets the number of elements the in-memory segments hold room for.
+     *
+     * Stays within the memory budget, or within two segments if the budget is smaller.
+     *
+     * @return The number of elements of memory in use, not counting iterator buffers.
+     */
+    std::size_t resident_size() const { return resident * segment_size; }
+
+    /**
+     * @brief Gets the size of the spill file, including extents free for reuse.
+     * @return The number of elements the spill file holds room for.
+     */
+    std::size_t spill_file_size() const { return file ? file->size() : 0; }
+
+    /**
+     * @brief Adds an element to the end of the list, spilling the filled segment if over budget.
+     * @param value The value to add.
+     * @throws std::runtime_error if a segment must be spilled and the write fails.
+     */
+    void push_back(const T& value) {
+        if (segments.empty() || segments.back().count == segment_size) {
+            if (segments.size() > 1 && resident >= budget_segments) spill(segments.back());
+            Segment fresh;
+            fresh.values.reserve(segment_size);
+            segments.push_back(std::move(fresh));
+            ++resident;
+        }
+        Segment& last = segments.back();
+        last.values.push_back(value);
+        ++last.count;
+        ++list_size;
+    }
+
+    /**
+     * @brief Adds an element to the end of the list.
+     * @param value The value to add.
+     */
+    void push(const T& value) {
+        push_back(value);
+    }
+
+    /**
+     * @brief Removes the element at the front of the list, reading the next segment back if spilled.
+     * @throws std::runtime_error if the list is empty.
+     */
+    void pop_front() {
+        if (list_size == 0) {
+            throw std::runtime_error("List is empty: cannot pop front.");
+        }
+        Segment& first = segments.front();
+        --list_size;
+        if (++first.begin < first.count) return;
+        segments.pop_front();
+        --resident;
+        if (!segments.empty() && segments.front().spilled) load(segments.front());
+    }
+
+    /**
+     * @brief Retrieves the element at the front of the list.
+     * @return A reference to the element.
+     * @throws std::runtime_error if the list is empty.
+     */
+    const T& front() const {
+        if (list_size == 0) {
+            throw std::runtime_error("List is empty: cannot access head.");
+        }
+        const Segment& first = segments.front();
+        return first.values[first.begin];
+    }
+
+    /**
+     * @brief Retrieves the element at the back of the list.
+     * @return A reference to the element.
+     * @throws std::runtime_error if the list is empty.
+     */
+    const T& back() const {
+        if (list_size == 0) {
+            throw std::runtime_error("List is empty: cannot access tail.");
+        }
+        return segments.back().values.back();
+    }
+
+    /**
+     * @brief Removes every element and releases the spill file.
+     */
+    void clear() {
+        segments.clear();
+        file.reset();
+        free_extents.clear();
+        resident = 0;
+        spilled_segments = 0;
+        list_size = 0;
+    }
+
+    /**
+     * @brief Forward iterator over the elements, reading spilled segments back one at a time.
+     *
+     * A spilled segment is read into a buffer shared by copies of the iterator, so the list's
+     * memory use grows by at most one segment per live iterator. The iterator is invalidated by
+     * any modification of the list.
+     */
+    class ConstIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        ConstIterator() : owner(nullptr), index(0) {}
+
+        ConstIterator(const SpillingList* list, typename SinglyLinkedList<Segment>::ConstIterator position)
+            : owner(list), segment(position), index(0) {
+            if (segment != owner->segments.end()) enter();
+        }
+
+        reference operator*() const {
+            return (buffer ? *buffer : segment->values)[index];
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        ConstIterator& operator++() {
+            if (++index == segment->count) {
+                ++segment;
+                index = 0;
+                buffer.reset();
+                if (segment != owner->segments.end()) enter();
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return segment == other.segment && index == other.index;
+        }
+
+        bool operator!=(const ConstIterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        void enter() {
+            index = segment->begin;
+            if (segment->spilled) {
+                buffer = std::make_shared<std::vector<T>>(owner->file->read(segment->position, segment->count));
+            }
+        }
+
+        const SpillingList* owner; //!< The list being iterated.
+        typename SinglyLinkedList<Segment>::ConstIterator segment; //!< The current segment.
+        std::size_t index; //!< Index of the current element in the segment; 0 at the end.
+        std::shared_ptr<std::vector<T>> buffer; //!< The current segment's elements if it is spilled.
+    };
+
+    /**
+     * @brief Gets a const iterator to the first element.
+     * @return A ConstIterator to the first element.
+     */
+    ConstIterator begin() const { return ConstIterator(this, segments.begin()); }
+
+    /**
+     * @brief Gets a const iterator to the end of the list.
+     * @return A ConstIterator to the end.
+     */
+    ConstIterator end() const { return ConstIterator(this, segments.end()); }
+};
+
+#endif // SPILLINGLIST_HPP
@@ -0,0 +1,94 @@
+#include "SpillingList.hpp"
+#include <iostream>
+#include <cassert>
+#include <numeric>
+#include <algorithm>
+
+int main() {
+    std::cout << "SpillingList MWE test starts!\n";
+
+    // Test FIFO order within the budget, without touching the disk
+    SpillingList<int> small(1 << 20, 16);
+    for (int i = 0; i < 100; ++i) small.push_back(i);
+    assert(small.size() == 100 && small.spilled_size() == 0);
+    assert(small.front() == 0 && small.back() == 99);
+    for (int i = 0; i < 50; ++i) small.pop_front();
+    assert(small.front() == 50 && small.size() == 50);
+    std::cout << "0\n";
+
+    // Test cold middle segments spill once the budget is exceeded, keeping the hot ends in memory
+    SpillingList<long> list(4 * 100 * sizeof(long), 100);
+    for (long i = 0; i < 10000; ++i) list.push_back(i);
+    assert(list.size() == 10000);
+    assert(list.spilled_size() > 0 && list.spilled_size() <= 10000 - 200);
+    assert(list.front() == 0 && list.back() == 9999);
+    std::cout << "1\n";
+
+    // Test iteration reads spilled segments back in order
+    long expected = 0;
+    for (long x : list) assert(x == expected++);
+    assert(expected == 10000);
+    assert(std::accumulate(list.begin(), list.end(), 0L) == 9999L * 10000 / 2);
+    std::cout << "2\n";
+
+    // Test pop_front pages segments back in and interleaves with push_back
+    for (long i = 0; i < 5000; ++i) {
+        assert(list.front() == i);
+        list.pop_front();
+    }
+    for (long i = 10000; i < 12000; ++i) list.push_back(i);
+    for (long i = 5000; i < 12000; ++i) {
+        assert(list.front() == i);
+        list.pop_front();
+    }
+    assert(list.empty() && list.spilled_size() == 0);
+    list.push_back(42);
+    assert(list.front() == 42 && list.back() == 42);
+    std::cout << "3\n";
+
+    // Test errors and clear
+    list.clear();
+    bool threw = false;
+    try { list.pop_front(); } catch (const std::runtime_error&) { threw = true; }
+    assert(threw && list.begin() == list.end());
+    std::cout << "4\n";
+
+    // Test the spill file stays bounded under a backlog that never drains
+    SpillingList<long> backlog(4 * 100 * sizeof(long), 100);
+    long pushed = 0;
+    long popped = 0;
+    for (; pushed < 3000; ++pushed) backlog.push_back(pushed);
+    std::size_t peak = backlog.spill_file_size();
+    assert(peak > 0);
+    for (int round = 0; round < 200; ++round) {
+        for (int i = 0; i < 100; ++i) backlog.push_back(pushed++);
+        for (int i = 0; i < 100; ++i) {
+            assert(backlog.front() == popped);
+            backlog.pop_front();
+            ++popped;
+        }
+        assert(backlog.spilled_size() > 0 && backlog.spill_file_size() <= peak + 100);
+    }
+    expected = popped;
+    for (long x : backlog) assert(x == expected++);
+    assert(expected == pushed);
+    std::cout << "5\n";
+
+    // Test the in-memory segments never exceed the memory budget
+    const std::size_t budget = 5 * 64 * sizeof(int);
+    SpillingList<int> bounded(budget, 64);
+    std::size_t peakBytes = 0;
+    for (int i = 0; i < 5000; ++i) {
+        bounded.push_back(i);
+        peakBytes = std::max(peakBytes, bounded.resident_size() * sizeof(int));
+        if (i % 3 == 0) {
+            bounded.pop_front();
+            peakBytes = std::max(peakBytes, bounded.resident_size() * sizeof(int));
+        }
+    }
+    assert(bounded.spilled_size() > 0 && peakBytes == budget);
+    std::cout << "6\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,306 @@
+#ifndef THREADCACHINGALLOCATOR_HPP
+#define THREADCACHINGALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Per-thread small-object caches with batched remote frees.
+ *
+ * Every thread owns a ThreadCache holding one free list per 16-byte size class, refilled from
+ * 64 KiB slabs that record their owning cache in a header. A block freed by its owner goes
+ * straight back onto the owner's free list. A block freed by another thread is collected into
+ * a batch for its owner, and the batch is pushed onto the owner's lock-free remote-free stack
+ * with a single compare-and-swap once it is full, once a block of another owner or of the
+ * freeing thread itself is freed, or once the freeing thread next allocates. The owner takes
+ * back its whole remote stack with one exchange when a free list runs dry. This serves the
+ * producer/consumer pattern, where one thread allocates nodes and another frees them, without
+ * contending on a global heap lock. A thread that only ever frees remote blocks keeps fewer
+ * than remote_batch_size of them pending until it calls flush() or exits.
+ *
+ * When a thread exits, its cache is parked and adopted by the next new thread. Slabs are
+ * therefore reused, but they are never returned to the operating system. Blocks freed on a
+ * thread after its cache was destroyed, such as by the destructors of static objects, are
+ * pushed to their owner one at a time; allocating on such a thread is not supported.
+ */
+class ThreadCacheHeap {
+public:
+    static constexpr std::size_t granularity = 16; //!< Size class step in bytes.
+    static constexpr std::size_t max_small_size = 512; //!< Largest size served from the caches.
+    static constexpr std::size_t slab_size = 64 * 1024; //!< Size and alignment of a slab.
+    static constexpr std::size_t class_count = max_small_size / granularity;
+    static constexpr std::size_t remote_batch_size = 64; //!< Remote frees collected before a push.
+
+    /**
+     * @brief Checks whether an allocation is served from the caches.
+     * @param bytes The size of the allocation.
+     * @param align The alignment of the allocation.
+     * @return True if the allocation goes through a thread cache.
+     */
+    static bool is_small(std::size_t bytes, std::size_t align) {
+        return bytes <= max_small_size && align <= granularity;
+    }
+
+    /**
+     * @brief Allocates a small block from the calling thread's cache.
+     * @param bytes The size of the block; must satisfy is_small().
+     * @return Pointer to the block.
+     */
+    static void* allocate(std::size_t bytes) {
+        Local& self = local();
+        self.batch.flush();
+        return self.cache->allocate(size_class(bytes));
+    }
+
+    /**
+     * @brief Frees a small block, locally or by handing it back to its owning thread.
+     * @param p Pointer previously returned by allocate().
+     */
+    static void deallocate(void* p) noexcept {
+        auto* block = static_cast<FreeBlock*>(p);
+        ThreadCache* owner = slab_of(block)->owner;
+        if (exited()) {
+            owner->push_remote(block, block);
+            return;
+        }
+        Local& self = local();
+        if (owner == self.cache) {
+            self.batch.flush();
+            owner->push_local(block);
+        } else {
+            self.batch.add(owner, block);
+        }
+    }
+
+    /**
+     * @brief Pushes the calling thread's pending remote frees to their owners.
+     */
+    static void flush() noexcept {
+        if (!exited()) local().batch.flush();
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next; //!< Next block in a free list.
+    };
+
+    struct ThreadCache;
+
+    /**
+     * @brief Header at the start of every slab.
+     */
+    struct alignas(64) SlabHeader {
+        ThreadCache* owner; //!< Cache that carved the slab.
+        std::size_t size_class; //!< Size class of every block in the slab.
+    };
+
+    static std::size_t size_class(std::size_t bytes) {
+        return bytes == 0 ? 0 : (bytes - 1) / granularity;
+    }
+
+    static SlabHeader* slab_of(const void* p) {
+        return reinterpret_cast<SlabHeader*>(reinterpret_cast<std::uintptr_t>(p) & ~(slab_size - 1));
+    }
+
+    /**
+     * @brief The caches of one thread, or of an exited thread awaiting adoption.
+     */
+    struct ThreadCache {
+        FreeBlock* free_lists[class_count] = {}; //!< Locally freed blocks per size class.
+        std::byte* bump[class_count] = {}; //!< Next uncarved block per size class.
+        std::byte* bump_end[class_count] = {}; //!< End of the slab being carved per size class.
+        std::atomic<FreeBlock*> remote{nullptr}; //!< Blocks freed by other threads.
+        ThreadCache* next_parked = nullptr; //!< Link in the parked cache stack.
+
+        void push_local(FreeBlock* block) {
+            std::size_t c = slab_of(block)->size_class;
+            block->next = free_lists[c];
+            free_lists[c] = block;
+        }
+
+        void push_remote(FreeBlock* first, FreeBlock* last) noexcept {
+            FreeBlock* head = remote.load(std::memory_order_relaxed);
+            do {
+                last->next = head;
+            } while (!remote.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        void drain_remote() {
+            FreeBlock* block = remote.exchange(nullptr, std::memory_order_acquire);
+            while (block) {
+                FreeBlock* next = block->next;
+                push_local(block);
+                block = next;
+            }
+        }
+
+        void* allocate(std::size_t c) {
+            if (!free_lists[c]) {
+                if (remote.load(std::memory_order_relaxed)) drain_remote();
+                if (!free_lists[c]) return carve(c);
+            }
+            FreeBlock* block = free_lists[c];
+            free_lists[c] = block->next;
+            return block;
+        }
+
+        void* carve(std::size_t c) {
+            std::size_t bytes = (c + 1) * granularity;
+            if (bump[c] == nullptr || bump[c] + bytes > bump_end[c]) {
+                auto* slab = static_cast<std::byte*>(::operator new(slab_size, std::align_val_t(slab_size)));
+                auto* header = new (slab) SlabHeader{this, c};
+                bump[c] = slab + sizeof(*header);
+                bump_end[c] = slab + slab_size;
+            }
+            void* block = bump[c];
+            bump[c] += bytes;
+            return block;
+        }
+    };
+
+    /**
+     * @brief Remote frees collected for one owner before they are pushed.
+     */
+    struct RemoteBatch {
+        ThreadCache* target = nullptr;
+        FreeBlock* first = nullptr;
+        FreeBlock* last = nullptr;
+        std::size_t count = 0;
+
+        void add(ThreadCache* owner, FreeBlock* block) noexcept {
+            if (owner != target) {
+                flush();
+                target = owner;
+            }
+            block->next = first;
+            first = block;
+            if (!last) last = block;
+            if (++count == remote_batch_size) flush();
+        }
+
+        void flush() noexcept {
+            if (!first) return;
+            target->push_remote(first, last);
+            first = last = nullptr;
+            count = 0;
+        }
+    };
+
+    /**
+     * @brief Caches of exited threads, waiting to be adopted.
+     */
+    struct Parking {
+        std::mutex mutex;
+        ThreadCache* parked = nullptr;
+    };
+
+    static Parking& parking() {
+        static Parking* instance = new Parking();
+        return *instance;
+    }
+
+    /**
+     * @brief Thread-local state: the thread's cache and its pending remote frees.
+     */
+    struct Local {
+        ThreadCache* cache;
+        RemoteBatch batch;
+
+        Local() {
+            Parking& p = parking();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            if (p.parked) {
+                cache = p.parked;
+                p.parked = cache->next_parked;
+            } else {
+                cache = new ThreadCache();
+            }
+        }
+
+        ~Local() {
+            exited() = true;
+            batch.flush();
+            Parking& p = parking();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            cache->next_parked = p.parked;
+            p.parked = cache;
+        }
+    };
+
+    static Local& local() {
+        thread_local Local state;
+        return state;
+    }
+
+    /**
+     * @brief Whether the calling thread's Local has been destroyed.
+     *
+     * Trivially destructible, so it stays readable while the thread's other thread-local and
+     * static objects are destroyed.
+     */
+    static bool& exited() noexcept {
+        thread_local bool flag = false;
+        return flag;
+    }
+};
+
+/**
+ * @brief Standard allocator backed by ThreadCacheHeap.
+ *
+ * Stateless, so all instances compare equal and memory may be freed on any thread. Allocations
+ * larger than ThreadCacheHeap::max_small_size, or over-aligned ones, use the global allocator.
+ *
+ * @tparam T Type of objects allocated.
+ */
+template<typename T>
+class ThreadCachingAllocator {
+public:
+    using value_type = T;
+
+    ThreadCachingAllocator() noexcept = default;
+
+    template<typename U>
+    ThreadCachingAllocator(const ThreadCachingAllocator<U>&) noexcept {}
+
+    /**
+     * @brief Allocates storage for n objects.
+     * @param n The number of objects.
+     * @return Pointer to the storage.
+     */
+    T* allocate(std::size_t n) {
+        if (is_small(n)) {
+            return static_cast<T*>(ThreadCacheHeap::allocate(n * sizeof(T)));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    }
+
+    /**
+     * @brief Frees storage previously returned by allocate().
+     * @param p Pointer to the storage.
+     * @param n The number of objects passed to allocate().
+     */
+    void deallocate(T* p, std::size_t n) noexcept {
+        if (is_small(n)) {
+            ThreadCacheHeap::deallocate(p);
+        } else {
+            ::operator delete(p, std::align_val_t(alignof(T)));
+        }
+    }
+
+    template<typename U>
+    bool operator==(const ThreadCachingAllocator<U>&) const noexcept { return true; }
+
+    template<typename U>
+    bool operator!=(const ThreadCachingAllocator<U>&) const noexcept { return false; }
+
+private:
+    static bool is_small(std::size_t n) noexcept {
+        return n <= ThreadCacheHeap::max_small_size / sizeof(T) && ThreadCacheHeap::is_small(n * sizeof(T), alignof(T));
+    }
+};
+
+#endif // THREADCACHINGALLOCATOR_HPP
@@ -0,0 +1,114 @@
+#include "ThreadCachingAllocator.hpp"
+#include "SinglyLinkedList.hpp"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <string>
+#include <array>
+#include <vector>
+#include <future>
+#include <algorithm>
+
+int main() {
+    std::cout << "ThreadCachingAllocator MWE test starts!\n";
+
+    // Test blocks freed by the allocating thread are reused
+    void* a = ThreadCacheHeap::allocate(24);
+    ThreadCacheHeap::deallocate(a);
+    void* b = ThreadCacheHeap::allocate(32);
+    assert(a == b);
+    ThreadCacheHeap::deallocate(b);
+    std::cout << "0\n";
+
+    // Test the allocator inside a list, including large values that bypass the caches
+    SinglyLinkedList<std::string, ThreadCachingAllocator<std::string>> strings;
+    for (int i = 0; i < 1000; ++i) strings.push_back(std::to_string(i));
+    assert(strings.size() == 1000 && strings.back() == "999");
+    SinglyLinkedList<std::array<char, 1024>, ThreadCachingAllocator<std::array<char, 1024>>> large;
+    large.push_back({});
+    assert(large.size() == 1);
+    std::cout << "1\n";
+
+    // Test nodes allocated on one thread and freed on another
+    using List = SinglyLinkedList<int, ThreadCachingAllocator<int>>;
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<List> handoff;
+    bool done = false;
+    std::thread producer([&] {
+        for (int batch = 0; batch < 200; ++batch) {
+            List local;
+            for (int i = 0; i < 100; ++i) local.push_back(batch * 100 + i);
+            std::lock_guard<std::mutex> lock(mutex);
+            handoff.push_back(std::move(local));
+            ready.notify_one();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+        ready.notify_one();
+    });
+    long long total = 0;
+    std::thread consumer([&] {
+        for (;;) {
+            List batch;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready.wait(lock, [&] { return !handoff.empty() || done; });
+                if (handoff.empty()) break;
+                batch = std::move(handoff.front());
+                handoff.pop_front();
+            }
+            while (!batch.empty()) {
+                total += batch.front();
+                batch.pop_front();
+            }
+        }
+        ThreadCacheHeap::flush();
+    });
+    producer.join();
+    consumer.join();
+    assert(total == 19999LL * 20000 / 2);
+    std::cout << "2\n";
+
+    // Test moves leave the source empty and keep the nodes
+    List moved;
+    moved.push_back(1);
+    moved.push_back(2);
+    List target(std::move(moved));
+    assert(moved.empty() && target.size() == 2 && target.back() == 2);
+    moved = std::move(target);
+    assert(target.empty() && moved.size() == 2);
+    moved.push_back(3);
+    assert(moved.back() == 3);
+    std::cout << "3\n";
+
+    // Test a partial batch of remote frees reaches its owner once the freeing thread allocates
+    std::vector<void*> owned;
+    for (int i = 0; i < 10; ++i) owned.push_back(ThreadCacheHeap::allocate(48));
+    std::promise<void> freed;
+    std::promise<void> finish;
+    std::thread freer([&] {
+        for (void* p : owned) ThreadCacheHeap::deallocate(p);
+        ThreadCacheHeap::deallocate(ThreadCacheHeap::allocate(48));
+        freed.set_value();
+        finish.get_future().wait();
+    });
+    freed.get_future().wait();
+    std::vector<void*> reused;
+    for (int i = 0; i < 10; ++i) reused.push_back(ThreadCacheHeap::allocate(48));
+    finish.set_value();
+    freer.join();
+    std::sort(owned.begin(), owned.end());
+    std::sort(reused.begin(), reused.end());
+    assert(owned == reused);
+    for (void* p : reused) ThreadCacheHeap::deallocate(p);
+    static List outlivesCache;
+    for (int i = 0; i < 10; ++i) outlivesCache.push_back(i);
+    std::cout << "4\n";
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}